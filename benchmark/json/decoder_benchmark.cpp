@@ -0,0 +1,109 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+// Measures decoder throughput with scalar and vectorized scanning on
+// minified and indented input.
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <trial/protocol/core/detail/simd.hpp>
+#include <trial/protocol/json/detail/decoder.hpp>
+
+using namespace trial::protocol;
+namespace simd = core::detail::simd;
+
+namespace
+{
+
+std::string make_document(std::size_t records, bool indent)
+{
+    const std::string newline = indent ? "\n" : "";
+    const std::string level1 = indent ? "    " : "";
+    const std::string level2 = indent ? "        " : "";
+    const std::string space = indent ? " " : "";
+
+    std::string result = "[" + newline;
+    for (std::size_t i = 0; i < records; ++i)
+    {
+        if (i > 0)
+            result += "," + newline;
+        result += level1 + "{" + newline;
+        result += level2 + "\"timestamp\":" + space + std::to_string(1500000000 + i) + "," + newline;
+        result += level2 + "\"level\":" + space + "\"info\"," + newline;
+        result += level2 + "\"message\":" + space + "\"Connection accepted from remote peer after handshake\"," + newline;
+        result += level2 + "\"tags\":" + space + "[\"network\"," + space + "\"session\"]" + newline;
+        result += level1 + "}";
+    }
+    result += newline + "]";
+    return result;
+}
+
+const char *name(simd::instruction_set isa)
+{
+    switch (isa)
+    {
+    case simd::instruction_set::scalar:
+        return "scalar";
+    case simd::instruction_set::sse2:
+        return "sse2";
+    case simd::instruction_set::avx2:
+        return "avx2";
+    }
+    return "unknown";
+}
+
+void measure(const char *label, const std::string& input, int iterations)
+{
+    const simd::instruction_set best = simd::detect();
+    const simd::instruction_set candidates[] = { simd::instruction_set::scalar,
+                                                 simd::instruction_set::sse2,
+                                                 simd::instruction_set::avx2 };
+    for (auto isa : candidates)
+    {
+        if (isa > best)
+            break;
+        simd::selected() = isa;
+
+        std::size_t tokens = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i)
+        {
+            json::detail::basic_decoder<char> decoder(input);
+            while (decoder.code() != json::token::detail::code::end)
+            {
+                ++tokens;
+                decoder.next();
+            }
+        }
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        const double megabytes = double(input.size()) * iterations / (1024.0 * 1024.0);
+        std::cout << std::left << std::setw(10) << label
+                  << std::setw(8) << name(isa)
+                  << std::right << std::setw(10) << std::fixed << std::setprecision(1)
+                  << megabytes / elapsed.count() << " MB/s"
+                  << std::setw(12) << tokens / iterations << " tokens" << std::endl;
+    }
+    simd::selected() = best;
+}
+
+} // anonymous namespace
+
+int main(int argc, char *argv[])
+{
+    const int iterations = (argc > 1) ? std::atoi(argv[1]) : 20;
+    const std::size_t records = 20000;
+
+    measure("minified", make_document(records, false), iterations);
+    measure("indented", make_document(records, true), iterations);
+    return 0;
+}
@@ -13,6 +13,7 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <iterator>
 #include <trial/dynamic/variable.hpp>
 
 namespace trial
@@ -31,10 +32,13 @@ auto erase(basic_variable<Allocator>& self,
     case symbol::map:
         {
             auto where = key::find(self, other);
-            auto result = where;
-            ++result;
+            if (where == self.key_end())
+                return where;
+            // Erasure may invalidate all iterators into the map, so the
+            // result is located by position. key::find is already linear.
+            const auto position = std::distance(self.key_begin(), where);
             self.erase(where.base());
-            return result;
+            return std::next(self.key_begin(), position);
         }
 
     default:
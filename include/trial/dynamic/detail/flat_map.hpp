@@ -0,0 +1,193 @@
+#ifndef TRIAL_DYNAMIC_DETAIL_FLAT_MAP_HPP
+#define TRIAL_DYNAMIC_DETAIL_FLAT_MAP_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace trial
+{
+namespace dynamic
+{
+namespace detail
+{
+
+//-----------------------------------------------------------------------------
+// flat_map
+//-----------------------------------------------------------------------------
+
+// Associative container that keeps its elements in a sorted vector.
+//
+// Has the same interface as std::map, but lookups perform a binary search
+// over contiguous memory, and the elements are stored in a single allocation.
+//
+// Unlike std::map, insertion and erasure are linear in the number of elements
+// and invalidate all iterators.
+
+template <typename Key,
+          typename T,
+          typename Compare = std::less<Key>,
+          typename Allocator = std::allocator<std::pair<Key, T>>>
+class flat_map
+{
+    using container_type = std::vector<std::pair<Key, T>, Allocator>;
+
+public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<Key, T>;
+    using size_type = typename container_type::size_type;
+    using difference_type = typename container_type::difference_type;
+    using key_compare = Compare;
+    using allocator_type = Allocator;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using pointer = typename container_type::pointer;
+    using const_pointer = typename container_type::const_pointer;
+    using iterator = typename container_type::iterator;
+    using const_iterator = typename container_type::const_iterator;
+    using reverse_iterator = typename container_type::reverse_iterator;
+    using const_reverse_iterator = typename container_type::const_reverse_iterator;
+
+    class value_compare
+    {
+    public:
+        bool operator() (const value_type& lhs, const value_type& rhs) const
+        {
+            return compare(lhs.first, rhs.first);
+        }
+
+    protected:
+        friend class flat_map;
+
+        value_compare(Compare compare) : compare(compare) {}
+
+        Compare compare;
+    };
+
+    flat_map() = default;
+    explicit flat_map(const allocator_type&);
+    template <typename InputIterator>
+    flat_map(InputIterator first, InputIterator last);
+    flat_map(std::initializer_list<value_type>);
+    flat_map(const flat_map&) = default;
+    flat_map(flat_map&&) = default;
+
+    flat_map& operator= (const flat_map&) = default;
+    flat_map& operator= (flat_map&&) = default;
+    flat_map& operator= (std::initializer_list<value_type>);
+
+    allocator_type get_allocator() const { return elements.get_allocator(); }
+    key_compare key_comp() const { return key_compare(); }
+    value_compare value_comp() const { return value_compare(key_compare()); }
+
+    // Element access
+
+    T& operator[] (const key_type&);
+    T& operator[] (key_type&&);
+    T& at(const key_type&);
+    const T& at(const key_type&) const;
+
+    // Iterators
+
+    iterator begin() noexcept { return elements.begin(); }
+    const_iterator begin() const noexcept { return elements.begin(); }
+    const_iterator cbegin() const noexcept { return elements.cbegin(); }
+    iterator end() noexcept { return elements.end(); }
+    const_iterator end() const noexcept { return elements.end(); }
+    const_iterator cend() const noexcept { return elements.cend(); }
+    reverse_iterator rbegin() noexcept { return elements.rbegin(); }
+    const_reverse_iterator rbegin() const noexcept { return elements.rbegin(); }
+    reverse_iterator rend() noexcept { return elements.rend(); }
+    const_reverse_iterator rend() const noexcept { return elements.rend(); }
+
+    // Capacity
+
+    bool empty() const noexcept { return elements.empty(); }
+    size_type size() const noexcept { return elements.size(); }
+    size_type max_size() const noexcept { return elements.max_size(); }
+    size_type capacity() const noexcept { return elements.capacity(); }
+    void reserve(size_type size) { elements.reserve(size); }
+
+    // Modifiers
+
+    void clear() noexcept { elements.clear(); }
+    std::pair<iterator, bool> insert(const value_type&);
+    std::pair<iterator, bool> insert(value_type&&);
+    iterator insert(const_iterator hint, const value_type&);
+    iterator insert(const_iterator hint, value_type&&);
+    template <typename InputIterator>
+    void insert(InputIterator first, InputIterator last);
+    void insert(std::initializer_list<value_type>);
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&...);
+    template <typename... Args>
+    iterator emplace_hint(const_iterator hint, Args&&...);
+    iterator erase(const_iterator);
+    iterator erase(const_iterator first, const_iterator last);
+    size_type erase(const key_type&);
+    void swap(flat_map&) noexcept;
+
+    // Lookup
+
+    size_type count(const key_type&) const;
+    iterator find(const key_type&);
+    const_iterator find(const key_type&) const;
+    iterator lower_bound(const key_type&);
+    const_iterator lower_bound(const key_type&) const;
+    iterator upper_bound(const key_type&);
+    const_iterator upper_bound(const key_type&) const;
+    std::pair<iterator, iterator> equal_range(const key_type&);
+    std::pair<const_iterator, const_iterator> equal_range(const key_type&) const;
+
+private:
+    template <typename V>
+    std::pair<iterator, bool> insert_unique(V&&);
+    template <typename V>
+    iterator insert_hint(const_iterator, V&&);
+    bool equivalent(const key_type&, const key_type&) const;
+
+    container_type elements;
+};
+
+template <typename K, typename T, typename C, typename A>
+bool operator== (const flat_map<K, T, C, A>&, const flat_map<K, T, C, A>&);
+
+template <typename K, typename T, typename C, typename A>
+bool operator!= (const flat_map<K, T, C, A>&, const flat_map<K, T, C, A>&);
+
+template <typename K, typename T, typename C, typename A>
+bool operator< (const flat_map<K, T, C, A>&, const flat_map<K, T, C, A>&);
+
+template <typename K, typename T, typename C, typename A>
+bool operator<= (const flat_map<K, T, C, A>&, const flat_map<K, T, C, A>&);
+
+template <typename K, typename T, typename C, typename A>
+bool operator> (const flat_map<K, T, C, A>&, const flat_map<K, T, C, A>&);
+
+template <typename K, typename T, typename C, typename A>
+bool operator>= (const flat_map<K, T, C, A>&, const flat_map<K, T, C, A>&);
+
+template <typename K, typename T, typename C, typename A>
+void swap(flat_map<K, T, C, A>&, flat_map<K, T, C, A>&) noexcept;
+
+} // namespace detail
+} // namespace dynamic
+} // namespace trial
+
+#include <trial/dynamic/detail/flat_map.ipp>
+
+#endif // TRIAL_DYNAMIC_DETAIL_FLAT_MAP_HPP
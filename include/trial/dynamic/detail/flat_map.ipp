@@ -0,0 +1,351 @@
+#ifndef TRIAL_DYNAMIC_DETAIL_FLAT_MAP_IPP
+#define TRIAL_DYNAMIC_DETAIL_FLAT_MAP_IPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace trial
+{
+namespace dynamic
+{
+namespace detail
+{
+
+template <typename K, typename T, typename C, typename A>
+flat_map<K, T, C, A>::flat_map(const allocator_type& allocator)
+    : elements(allocator)
+{
+}
+
+template <typename K, typename T, typename C, typename A>
+template <typename InputIterator>
+flat_map<K, T, C, A>::flat_map(InputIterator first, InputIterator last)
+{
+    insert(first, last);
+}
+
+template <typename K, typename T, typename C, typename A>
+flat_map<K, T, C, A>::flat_map(std::initializer_list<value_type> init)
+{
+    insert(init.begin(), init.end());
+}
+
+template <typename K, typename T, typename C, typename A>
+auto flat_map<K, T, C, A>::operator= (std::initializer_list<value_type> init) -> flat_map&
+{
+    clear();
+    insert(init.begin(), init.end());
+    return *this;
+}
+
+template <typename K, typename T, typename C, typename A>
+T& flat_map<K, T, C, A>::operator[] (const key_type& key)
+{
+    auto where = lower_bound(key);
+    if ((where == end()) || key_comp()(key, where->first))
+    {
+        where = elements.emplace(where, key, mapped_type{});
+    }
+    return where->second;
+}
+
+template <typename K, typename T, typename C, typename A>
+T& flat_map<K, T, C, A>::operator[] (key_type&& key)
+{
+    auto where = lower_bound(key);
+    if ((where == end()) || key_comp()(key, where->first))
+    {
+        where = elements.emplace(where, std::move(key), mapped_type{});
+    }
+    return where->second;
+}
+
+template <typename K, typename T, typename C, typename A>
+T& flat_map<K, T, C, A>::at(const key_type& key)
+{
+    auto where = find(key);
+    if (where == end())
+        throw std::out_of_range("flat_map::at");
+    return where->second;
+}
+
+template <typename K, typename T, typename C, typename A>
+const T& flat_map<K, T, C, A>::at(const key_type& key) const
+{
+    auto where = find(key);
+    if (where == end())
+        throw std::out_of_range("flat_map::at");
+    return where->second;
+}
+
+template <typename K, typename T, typename C, typename A>
+auto flat_map<K, T, C, A>::insert(const value_type& value) -> std::pair<iterator, bool>
+{
+    return insert_unique(value);
+}
+
+template <typename K, typename T, typename C, typename A>
+auto flat_map<K, T, C, A>::insert(value_type&& value) -> std::pair<iterator, bool>
+{
+    return insert_unique(std::move(value));
+}
+
+template <typename K, typename T, typename C, typename A>
+auto flat_map<K, T, C, A>::insert(const_iterator hint, const value_type& value) -> iterator
+{
+    return insert_hint(hint, value);
+}
+
+template <typename K, typename T, typename C, typename A>
+auto flat_map<K, T, C, A>::insert(const_iterator hint, value_type&& value) -> iterator
+{
+    return insert_hint(hint, std::move(value));
+}
+
+template <typename K, typename T, typename C, typename A>
+template <typename InputIterator>
+void flat_map<K, T, C, A>::insert(InputIterator first, InputIterator last)
+{
+    // Append the new elements and merge them into the sorted sequence. Both
+    // the sort and the merge are stable, so the first of several equivalent
+    // keys is the one that is retained, as with std::map.
+    const auto old_size = elements.size();
+    elements.insert(elements.end(), first, last);
+    auto middle = std::next(elements.begin(), difference_type(old_size));
+    std::stable_sort(middle, elements.end(), value_comp());
+    std::inplace_merge(elements.begin(), middle, elements.end(), value_comp());
+    auto last_unique = std::unique(elements.begin(),
+                                   elements.end(),
+                                   [this] (const value_type& lhs, const value_type& rhs)
+                                   {
+                                       return equivalent(lhs.first, rhs.first);
+                                   });
+    elements.erase(last_unique, elements.end());
+}
+
+template <typename K, typename T, typename C, typename A>
+void flat_map<K, T, C, A>::insert(std::initializer_list<value_type> init)
+{
+    insert(init.begin(), init.end());
+}
+
+template <typename K, typename T, typename C, typename A>
+template <typename... Args>
+auto flat_map<K, T, C, A>::emplace(Args&&... args) -> std::pair<iterator, bool>
+{
+    return insert_unique(value_type(std::forward<Args>(args)...));
+}
+
+template <typename K, typename T, typename C, typename A>
+template <typename... Args>
+auto flat_map<K, T, C, A>::emplace_hint(const_iterator hint, Args&&... args) -> iterator
+{
+    return insert_hint(hint, value_type(std::forward<Args>(args)...));
+}
+
+template <typename K, typename T, typename C, typename A>
+auto flat_map<K, T, C, A>::erase(const_iterator where) -> iterator
+{
+    return elements.erase(where);
+}
+
+template <typename K, typename T, typename C, typename A>
+auto flat_map<K, T, C, A>::erase(const_iterator first, const_iterator last) -> iterator
+{
+    return elements.erase(first, last);
+}
+
+template <typename K, typename T, typename C, typename A>
+auto flat_map<K, T, C, A>::erase(const key_type& key) -> size_type
+{
+    auto where = find(key);
+    if (where == end())
+        return 0;
+    elements.erase(where);
+    return 1;
+}
+
+template <typename K, typename T, typename C, typename A>
+void flat_map<K, T, C, A>::swap(flat_map& other) noexcept
+{
+    elements.swap(other.elements);
+}
+
+template <typename K, typename T, typename C, typename A>
+auto flat_map<K, T, C, A>::count(const key_type& key) const -> size_type
+{
+    return (find(key) == end()) ? 0 : 1;
+}
+
+template <typename K, typename T, typename C, typename A>
+auto flat_map<K, T, C, A>::find(const key_type& key) -> iterator
+{
+    auto where = lower_bound(key);
+    return ((where == end()) || key_comp()(key, where->first)) ? end() : where;
+}
+
+template <typename K, typename T, typename C, typename A>
+auto flat_map<K, T, C, A>::find(const key_type& key) const -> const_iterator
+{
+    auto where = lower_bound(key);
+    return ((where == end()) || key_comp()(key, where->first)) ? end() : where;
+}
+
+template <typename K, typename T, typename C, typename A>
+auto flat_map<K, T, C, A>::lower_bound(const key_type& key) -> iterator
+{
+    return std::lower_bound(begin(),
+                            end(),
+                            key,
+                            [] (const value_type& lhs, const key_type& rhs)
+                            {
+                                return key_compare()(lhs.first, rhs);
+                            });
+}
+
+template <typename K, typename T, typename C, typename A>
+auto flat_map<K, T, C, A>::lower_bound(const key_type& key) const -> const_iterator
+{
+    return std::lower_bound(begin(),
+                            end(),
+                            key,
+                            [] (const value_type& lhs, const key_type& rhs)
+                            {
+                                return key_compare()(lhs.first, rhs);
+                            });
+}
+
+template <typename K, typename T, typename C, typename A>
+auto flat_map<K, T, C, A>::upper_bound(const key_type& key) -> iterator
+{
+    return std::upper_bound(begin(),
+                            end(),
+                            key,
+                            [] (const key_type& lhs, const value_type& rhs)
+                            {
+                                return key_compare()(lhs, rhs.first);
+                            });
+}
+
+template <typename K, typename T, typename C, typename A>
+auto flat_map<K, T, C, A>::upper_bound(const key_type& key) const -> const_iterator
+{
+    return std::upper_bound(begin(),
+                            end(),
+                            key,
+                            [] (const key_type& lhs, const value_type& rhs)
+                            {
+                                return key_compare()(lhs, rhs.first);
+                            });
+}
+
+template <typename K, typename T, typename C, typename A>
+auto flat_map<K, T, C, A>::equal_range(const key_type& key) -> std::pair<iterator, iterator>
+{
+    auto first = find(key);
+    return { first, (first == end()) ? first : std::next(first) };
+}
+
+template <typename K, typename T, typename C, typename A>
+auto flat_map<K, T, C, A>::equal_range(const key_type& key) const -> std::pair<const_iterator, const_iterator>
+{
+    auto first = find(key);
+    return { first, (first == end()) ? first : std::next(first) };
+}
+
+template <typename K, typename T, typename C, typename A>
+template <typename V>
+auto flat_map<K, T, C, A>::insert_unique(V&& value) -> std::pair<iterator, bool>
+{
+    // Appending in sorted order is the common case when copying a map
+    if (empty() || key_comp()(elements.back().first, value.first))
+    {
+        elements.push_back(std::forward<V>(value));
+        return { std::prev(end()), true };
+    }
+    auto where = lower_bound(value.first);
+    if ((where != end()) && !key_comp()(value.first, where->first))
+        return { where, false };
+    return { elements.insert(where, std::forward<V>(value)), true };
+}
+
+template <typename K, typename T, typename C, typename A>
+template <typename V>
+auto flat_map<K, T, C, A>::insert_hint(const_iterator hint, V&& value) -> iterator
+{
+    // Use hint if value belongs immediately before it
+    if (((hint == cend()) || key_comp()(value.first, hint->first)) &&
+        ((hint == cbegin()) || key_comp()(std::prev(hint)->first, value.first)))
+    {
+        return elements.insert(hint, std::forward<V>(value));
+    }
+    return insert_unique(std::forward<V>(value)).first;
+}
+
+template <typename K, typename T, typename C, typename A>
+bool flat_map<K, T, C, A>::equivalent(const key_type& lhs, const key_type& rhs) const
+{
+    return !key_comp()(lhs, rhs) && !key_comp()(rhs, lhs);
+}
+
+//-----------------------------------------------------------------------------
+// Non-member functions
+//-----------------------------------------------------------------------------
+
+template <typename K, typename T, typename C, typename A>
+bool operator== (const flat_map<K, T, C, A>& lhs, const flat_map<K, T, C, A>& rhs)
+{
+    return (lhs.size() == rhs.size()) && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename K, typename T, typename C, typename A>
+bool operator!= (const flat_map<K, T, C, A>& lhs, const flat_map<K, T, C, A>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <typename K, typename T, typename C, typename A>
+bool operator< (const flat_map<K, T, C, A>& lhs, const flat_map<K, T, C, A>& rhs)
+{
+    return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename K, typename T, typename C, typename A>
+bool operator<= (const flat_map<K, T, C, A>& lhs, const flat_map<K, T, C, A>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <typename K, typename T, typename C, typename A>
+bool operator> (const flat_map<K, T, C, A>& lhs, const flat_map<K, T, C, A>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <typename K, typename T, typename C, typename A>
+bool operator>= (const flat_map<K, T, C, A>& lhs, const flat_map<K, T, C, A>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+template <typename K, typename T, typename C, typename A>
+void swap(flat_map<K, T, C, A>& lhs, flat_map<K, T, C, A>& rhs) noexcept
+{
+    lhs.swap(rhs);
+}
+
+} // namespace detail
+} // namespace dynamic
+} // namespace trial
+
+#endif // TRIAL_DYNAMIC_DETAIL_FLAT_MAP_IPP
@@ -0,0 +1,160 @@
+#ifndef TRIAL_DYNAMIC_DETAIL_SHARED_STRING_HPP
+#define TRIAL_DYNAMIC_DETAIL_SHARED_STRING_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <atomic>
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+
+namespace trial
+{
+namespace dynamic
+{
+namespace detail
+{
+
+//-----------------------------------------------------------------------------
+// basic_shared_string
+//-----------------------------------------------------------------------------
+
+// String with shared storage.
+//
+// Short strings are stored inline like the small-string optimization of
+// std::basic_string. Longer strings are stored in a reference-counted buffer,
+// so copies share the same characters. A shared buffer is copied before it is
+// modified, so the string otherwise behaves like an ordinary value.
+//
+// Strings that share a buffer compare equal without examining the content.
+
+template <typename CharT, typename Traits = std::char_traits<CharT>>
+class basic_shared_string
+{
+    struct buffer;
+
+public:
+    using traits_type = Traits;
+    using value_type = CharT;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using pointer = value_type *;
+    using const_pointer = const value_type *;
+    using iterator = const_pointer;
+    using const_iterator = const_pointer;
+
+    basic_shared_string() noexcept;
+    basic_shared_string(const basic_shared_string&) noexcept;
+    basic_shared_string(basic_shared_string&&) noexcept;
+    basic_shared_string(const value_type *);
+    basic_shared_string(const value_type *, size_type);
+    template <typename Allocator>
+    basic_shared_string(const std::basic_string<CharT, Traits, Allocator>&);
+    ~basic_shared_string();
+
+    basic_shared_string& operator= (const basic_shared_string&) noexcept;
+    basic_shared_string& operator= (basic_shared_string&&) noexcept;
+    basic_shared_string& operator= (const value_type *);
+
+    // Capacity
+
+    bool empty() const noexcept;
+    size_type size() const noexcept;
+    size_type length() const noexcept;
+
+    // Element access
+
+    const_reference operator[] (size_type) const noexcept;
+    const_pointer data() const noexcept;
+    const_pointer c_str() const noexcept;
+
+    // Iterators
+
+    const_iterator begin() const noexcept;
+    const_iterator end() const noexcept;
+    const_iterator cbegin() const noexcept;
+    const_iterator cend() const noexcept;
+
+    // Modifiers
+
+    void clear() noexcept;
+    basic_shared_string& append(const basic_shared_string&);
+    basic_shared_string& append(const value_type *);
+    basic_shared_string& append(const value_type *, size_type);
+    basic_shared_string& operator+= (const basic_shared_string&);
+    basic_shared_string& operator+= (const value_type *);
+    void swap(basic_shared_string&) noexcept;
+
+    // Operations
+
+    int compare(const basic_shared_string&) const noexcept;
+    int compare(const value_type *) const noexcept;
+
+    // Returns true if both strings refer to the same shared buffer
+    bool shares(const basic_shared_string&) const noexcept;
+
+    // Strings shorter than this are stored inline
+    static const size_type local_capacity = 16 / sizeof(value_type);
+
+private:
+    bool is_local() const noexcept;
+    static buffer *allocate(size_type capacity);
+    void assign(const value_type *, size_type);
+    void acquire(const basic_shared_string&) noexcept;
+    void steal(basic_shared_string&) noexcept;
+    void release() noexcept;
+
+    size_type count;
+    union
+    {
+        value_type local[local_capacity];
+        buffer *shared;
+    };
+};
+
+template <typename C, typename T>
+bool operator== (const basic_shared_string<C, T>&, const basic_shared_string<C, T>&) noexcept;
+template <typename C, typename T>
+bool operator== (const basic_shared_string<C, T>&, const C *) noexcept;
+template <typename C, typename T>
+bool operator== (const C *, const basic_shared_string<C, T>&) noexcept;
+
+template <typename C, typename T>
+bool operator!= (const basic_shared_string<C, T>&, const basic_shared_string<C, T>&) noexcept;
+template <typename C, typename T>
+bool operator!= (const basic_shared_string<C, T>&, const C *) noexcept;
+template <typename C, typename T>
+bool operator!= (const C *, const basic_shared_string<C, T>&) noexcept;
+
+template <typename C, typename T>
+bool operator< (const basic_shared_string<C, T>&, const basic_shared_string<C, T>&) noexcept;
+template <typename C, typename T>
+bool operator<= (const basic_shared_string<C, T>&, const basic_shared_string<C, T>&) noexcept;
+template <typename C, typename T>
+bool operator> (const basic_shared_string<C, T>&, const basic_shared_string<C, T>&) noexcept;
+template <typename C, typename T>
+bool operator>= (const basic_shared_string<C, T>&, const basic_shared_string<C, T>&) noexcept;
+
+template <typename C, typename T>
+void swap(basic_shared_string<C, T>&, basic_shared_string<C, T>&) noexcept;
+
+template <typename C, typename T>
+std::basic_ostream<C, T>& operator<< (std::basic_ostream<C, T>&, const basic_shared_string<C, T>&);
+
+} // namespace detail
+} // namespace dynamic
+} // namespace trial
+
+#include <trial/dynamic/detail/shared_string.ipp>
+
+#endif // TRIAL_DYNAMIC_DETAIL_SHARED_STRING_HPP
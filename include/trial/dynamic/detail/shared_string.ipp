@@ -0,0 +1,444 @@
+#ifndef TRIAL_DYNAMIC_DETAIL_SHARED_STRING_IPP
+#define TRIAL_DYNAMIC_DETAIL_SHARED_STRING_IPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <new>
+#include <ostream>
+#include <utility>
+
+namespace trial
+{
+namespace dynamic
+{
+namespace detail
+{
+
+// Reference-counted header that is followed by the characters
+template <typename C, typename T>
+struct basic_shared_string<C, T>::buffer
+{
+    buffer(size_type capacity) noexcept
+        : references(1),
+          capacity(capacity)
+    {}
+
+    value_type *data() noexcept
+    {
+        return reinterpret_cast<value_type *>(this + 1);
+    }
+
+    std::atomic<std::size_t> references;
+    size_type capacity; // excluding terminating null
+};
+
+template <typename C, typename T>
+basic_shared_string<C, T>::basic_shared_string() noexcept
+    : count(0)
+{
+    local[0] = value_type();
+}
+
+template <typename C, typename T>
+basic_shared_string<C, T>::basic_shared_string(const basic_shared_string& other) noexcept
+{
+    acquire(other);
+}
+
+template <typename C, typename T>
+basic_shared_string<C, T>::basic_shared_string(basic_shared_string&& other) noexcept
+{
+    steal(other);
+}
+
+template <typename C, typename T>
+basic_shared_string<C, T>::basic_shared_string(const value_type *data)
+{
+    assign(data, traits_type::length(data));
+}
+
+template <typename C, typename T>
+basic_shared_string<C, T>::basic_shared_string(const value_type *data, size_type size)
+{
+    assign(data, size);
+}
+
+template <typename C, typename T>
+template <typename Allocator>
+basic_shared_string<C, T>::basic_shared_string(const std::basic_string<C, T, Allocator>& other)
+{
+    assign(other.data(), other.size());
+}
+
+template <typename C, typename T>
+basic_shared_string<C, T>::~basic_shared_string()
+{
+    release();
+}
+
+template <typename C, typename T>
+auto basic_shared_string<C, T>::operator= (const basic_shared_string& other) noexcept -> basic_shared_string&
+{
+    if (this != &other)
+    {
+        release();
+        acquire(other);
+    }
+    return *this;
+}
+
+template <typename C, typename T>
+auto basic_shared_string<C, T>::operator= (basic_shared_string&& other) noexcept -> basic_shared_string&
+{
+    if (this != &other)
+    {
+        release();
+        steal(other);
+    }
+    return *this;
+}
+
+template <typename C, typename T>
+auto basic_shared_string<C, T>::operator= (const value_type *data) -> basic_shared_string&
+{
+    // The characters may belong to this string
+    return *this = basic_shared_string(data);
+}
+
+template <typename C, typename T>
+bool basic_shared_string<C, T>::empty() const noexcept
+{
+    return count == 0;
+}
+
+template <typename C, typename T>
+auto basic_shared_string<C, T>::size() const noexcept -> size_type
+{
+    return count;
+}
+
+template <typename C, typename T>
+auto basic_shared_string<C, T>::length() const noexcept -> size_type
+{
+    return count;
+}
+
+template <typename C, typename T>
+auto basic_shared_string<C, T>::operator[] (size_type position) const noexcept -> const_reference
+{
+    return data()[position];
+}
+
+template <typename C, typename T>
+auto basic_shared_string<C, T>::data() const noexcept -> const_pointer
+{
+    return is_local() ? local : shared->data();
+}
+
+template <typename C, typename T>
+auto basic_shared_string<C, T>::c_str() const noexcept -> const_pointer
+{
+    return data();
+}
+
+template <typename C, typename T>
+auto basic_shared_string<C, T>::begin() const noexcept -> const_iterator
+{
+    return data();
+}
+
+template <typename C, typename T>
+auto basic_shared_string<C, T>::end() const noexcept -> const_iterator
+{
+    return data() + count;
+}
+
+template <typename C, typename T>
+auto basic_shared_string<C, T>::cbegin() const noexcept -> const_iterator
+{
+    return begin();
+}
+
+template <typename C, typename T>
+auto basic_shared_string<C, T>::cend() const noexcept -> const_iterator
+{
+    return end();
+}
+
+template <typename C, typename T>
+void basic_shared_string<C, T>::clear() noexcept
+{
+    release();
+    count = 0;
+    local[0] = value_type();
+}
+
+template <typename C, typename T>
+auto basic_shared_string<C, T>::append(const basic_shared_string& other) -> basic_shared_string&
+{
+    return append(other.data(), other.size());
+}
+
+template <typename C, typename T>
+auto basic_shared_string<C, T>::append(const value_type *data) -> basic_shared_string&
+{
+    return append(data, traits_type::length(data));
+}
+
+template <typename C, typename T>
+auto basic_shared_string<C, T>::append(const value_type *data, size_type size) -> basic_shared_string&
+{
+    if (size == 0)
+        return *this;
+
+    const size_type total = count + size;
+    if (total < local_capacity)
+    {
+        traits_type::copy(local + count, data, size);
+        local[total] = value_type();
+        count = total;
+        return *this;
+    }
+
+    if (!is_local() &&
+        (shared->references.load(std::memory_order_acquire) == 1) &&
+        (total <= shared->capacity))
+    {
+        // Unique buffer with room for the characters
+        traits_type::copy(shared->data() + count, data, size);
+        shared->data()[total] = value_type();
+        count = total;
+        return *this;
+    }
+
+    // Copy into a new buffer before the old buffer is released, because the
+    // appended characters may belong to it
+    buffer *grown = allocate(std::max(total, 2 * count));
+    traits_type::copy(grown->data(), this->data(), count);
+    traits_type::copy(grown->data() + count, data, size);
+    grown->data()[total] = value_type();
+    release();
+    count = total;
+    shared = grown;
+    return *this;
+}
+
+template <typename C, typename T>
+auto basic_shared_string<C, T>::operator+= (const basic_shared_string& other) -> basic_shared_string&
+{
+    return append(other);
+}
+
+template <typename C, typename T>
+auto basic_shared_string<C, T>::operator+= (const value_type *data) -> basic_shared_string&
+{
+    return append(data);
+}
+
+template <typename C, typename T>
+void basic_shared_string<C, T>::swap(basic_shared_string& other) noexcept
+{
+    basic_shared_string temporary(std::move(other));
+    other = std::move(*this);
+    *this = std::move(temporary);
+}
+
+template <typename C, typename T>
+int basic_shared_string<C, T>::compare(const basic_shared_string& other) const noexcept
+{
+    // Strings that share a buffer have the same characters
+    if (data() != other.data())
+    {
+        const int result = traits_type::compare(data(), other.data(), std::min(count, other.count));
+        if (result != 0)
+            return result;
+    }
+    return (count < other.count) ? -1 : ((other.count < count) ? 1 : 0);
+}
+
+template <typename C, typename T>
+int basic_shared_string<C, T>::compare(const value_type *other) const noexcept
+{
+    const size_type size = traits_type::length(other);
+    const int result = traits_type::compare(data(), other, std::min(count, size));
+    if (result != 0)
+        return result;
+    return (count < size) ? -1 : ((size < count) ? 1 : 0);
+}
+
+template <typename C, typename T>
+bool basic_shared_string<C, T>::shares(const basic_shared_string& other) const noexcept
+{
+    return !is_local() && !other.is_local() && (shared == other.shared);
+}
+
+template <typename C, typename T>
+bool basic_shared_string<C, T>::is_local() const noexcept
+{
+    return count < local_capacity;
+}
+
+template <typename C, typename T>
+auto basic_shared_string<C, T>::allocate(size_type capacity) -> buffer *
+{
+    void *memory = ::operator new(sizeof(buffer) + (capacity + 1) * sizeof(value_type));
+    return new (memory) buffer(capacity);
+}
+
+template <typename C, typename T>
+void basic_shared_string<C, T>::assign(const value_type *data, size_type size)
+{
+    count = size;
+    if (is_local())
+    {
+        traits_type::copy(local, data, size);
+        local[size] = value_type();
+    }
+    else
+    {
+        shared = allocate(size);
+        traits_type::copy(shared->data(), data, size);
+        shared->data()[size] = value_type();
+    }
+}
+
+template <typename C, typename T>
+void basic_shared_string<C, T>::acquire(const basic_shared_string& other) noexcept
+{
+    count = other.count;
+    if (other.is_local())
+    {
+        traits_type::copy(local, other.local, count + 1);
+    }
+    else
+    {
+        shared = other.shared;
+        shared->references.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+template <typename C, typename T>
+void basic_shared_string<C, T>::steal(basic_shared_string& other) noexcept
+{
+    count = other.count;
+    if (other.is_local())
+    {
+        traits_type::copy(local, other.local, count + 1);
+    }
+    else
+    {
+        shared = other.shared;
+        other.count = 0;
+        other.local[0] = value_type();
+    }
+}
+
+template <typename C, typename T>
+void basic_shared_string<C, T>::release() noexcept
+{
+    if (is_local())
+        return;
+
+    if (shared->references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        shared->~buffer();
+        ::operator delete(shared);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Non-member functions
+//-----------------------------------------------------------------------------
+
+template <typename C, typename T>
+bool operator== (const basic_shared_string<C, T>& lhs, const basic_shared_string<C, T>& rhs) noexcept
+{
+    if (lhs.size() != rhs.size())
+        return false;
+    // Interned strings are compared by address
+    if (lhs.data() == rhs.data())
+        return true;
+    return T::compare(lhs.data(), rhs.data(), lhs.size()) == 0;
+}
+
+template <typename C, typename T>
+bool operator== (const basic_shared_string<C, T>& lhs, const C *rhs) noexcept
+{
+    return lhs.compare(rhs) == 0;
+}
+
+template <typename C, typename T>
+bool operator== (const C *lhs, const basic_shared_string<C, T>& rhs) noexcept
+{
+    return rhs.compare(lhs) == 0;
+}
+
+template <typename C, typename T>
+bool operator!= (const basic_shared_string<C, T>& lhs, const basic_shared_string<C, T>& rhs) noexcept
+{
+    return !(lhs == rhs);
+}
+
+template <typename C, typename T>
+bool operator!= (const basic_shared_string<C, T>& lhs, const C *rhs) noexcept
+{
+    return !(lhs == rhs);
+}
+
+template <typename C, typename T>
+bool operator!= (const C *lhs, const basic_shared_string<C, T>& rhs) noexcept
+{
+    return !(lhs == rhs);
+}
+
+template <typename C, typename T>
+bool operator< (const basic_shared_string<C, T>& lhs, const basic_shared_string<C, T>& rhs) noexcept
+{
+    return lhs.compare(rhs) < 0;
+}
+
+template <typename C, typename T>
+bool operator<= (const basic_shared_string<C, T>& lhs, const basic_shared_string<C, T>& rhs) noexcept
+{
+    return lhs.compare(rhs) <= 0;
+}
+
+template <typename C, typename T>
+bool operator> (const basic_shared_string<C, T>& lhs, const basic_shared_string<C, T>& rhs) noexcept
+{
+    return lhs.compare(rhs) > 0;
+}
+
+template <typename C, typename T>
+bool operator>= (const basic_shared_string<C, T>& lhs, const basic_shared_string<C, T>& rhs) noexcept
+{
+    return lhs.compare(rhs) >= 0;
+}
+
+template <typename C, typename T>
+void swap(basic_shared_string<C, T>& lhs, basic_shared_string<C, T>& rhs) noexcept
+{
+    lhs.swap(rhs);
+}
+
+template <typename C, typename T>
+std::basic_ostream<C, T>& operator<< (std::basic_ostream<C, T>& stream,
+                                      const basic_shared_string<C, T>& value)
+{
+    return stream.write(value.data(), std::streamsize(value.size()));
+}
+
+} // namespace detail
+} // namespace dynamic
+} // namespace trial
+
+#endif // TRIAL_DYNAMIC_DETAIL_SHARED_STRING_IPP
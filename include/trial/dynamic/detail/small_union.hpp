@@ -63,6 +63,7 @@ private:
     template <std::size_t M, typename T, typename Enable> friend struct small_traits;
 
     struct reconstructor;
+    struct move_reconstructor;
     struct destructor;
     struct copier;
     struct mover;
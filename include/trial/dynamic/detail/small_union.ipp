@@ -167,7 +167,7 @@ small_union<Allocator, MaxType, IndexType, Types...>::small_union(const small_un
     : Allocator(std::allocator_traits<Allocator>::select_on_container_copy_construction(other)),
       current(other.current)
 {
-    call<copier, void>(other);
+    call<reconstructor, void>(other);
 }
 
 template <typename Allocator, typename MaxType, typename IndexType, typename... Types>
@@ -175,7 +175,7 @@ small_union<Allocator, MaxType, IndexType, Types...>::small_union(small_union&&
     : Allocator(other),
       current(other.current)
 {
-    call<mover, void>(std::move(other));
+    call<move_reconstructor, void>(std::move(other));
 }
 
 template <typename Allocator, typename MaxType, typename IndexType, typename... Types>
@@ -320,6 +320,18 @@ struct small_union<Allocator, MaxType, IndexType, Types...>::reconstructor
     }
 };
 
+template <typename Allocator, typename MaxType, typename IndexType, typename... Types>
+struct small_union<Allocator, MaxType, IndexType, Types...>::move_reconstructor
+{
+    template <typename T>
+    static void call(small_union& self, small_union&& other)
+    {
+        small_traits<sizeof(MaxType), T>::construct(static_cast<allocator_type&>(self),
+                                                    std::addressof(self.storage),
+                                                    std::move(other.get<T>()));
+    }
+};
+
 template <typename Allocator, typename MaxType, typename IndexType, typename... Types>
 struct small_union<Allocator, MaxType, IndexType, Types...>::destructor
 {
@@ -0,0 +1,73 @@
+#ifndef TRIAL_DYNAMIC_DETAIL_STRING_POOL_IPP
+#define TRIAL_DYNAMIC_DETAIL_STRING_POOL_IPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+namespace trial
+{
+namespace dynamic
+{
+
+template <typename CharT>
+auto basic_string_pool<CharT>::intern(const value_type *data, size_type size) -> string_type
+{
+    if (size < string_type::local_capacity)
+        return string_type(data, size);
+
+    auto where = strings.find(key_type{ data, size });
+    if (where == strings.end())
+    {
+        string_type interned(data, size);
+        // The key refers to the buffer of the pooled string, which does not
+        // move when the table is rehashed
+        const key_type key{ interned.data(), interned.size() };
+        where = strings.emplace(key, std::move(interned)).first;
+    }
+    return where->second;
+}
+
+template <typename CharT>
+auto basic_string_pool<CharT>::size() const noexcept -> size_type
+{
+    return strings.size();
+}
+
+template <typename CharT>
+void basic_string_pool<CharT>::clear() noexcept
+{
+    strings.clear();
+}
+
+template <typename CharT>
+std::size_t basic_string_pool<CharT>::key_hash::operator() (const key_type& key) const noexcept
+{
+    // FNV-1a
+    std::size_t result = 14695981039346656037ULL & std::size_t(-1);
+    for (size_type k = 0; k < key.size; ++k)
+    {
+        result ^= std::size_t(key.data[k]);
+        result *= std::size_t(1099511628211ULL);
+    }
+    return result;
+}
+
+template <typename CharT>
+bool basic_string_pool<CharT>::key_equal::operator() (const key_type& lhs,
+                                                       const key_type& rhs) const noexcept
+{
+    return (lhs.size == rhs.size) &&
+        (std::char_traits<value_type>::compare(lhs.data, rhs.data, lhs.size) == 0);
+}
+
+} // namespace dynamic
+} // namespace trial
+
+#endif // TRIAL_DYNAMIC_DETAIL_STRING_POOL_IPP
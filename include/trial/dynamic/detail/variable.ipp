@@ -889,7 +889,7 @@ struct overloader<
         }
     }
 
-    static void append(variable& self, const U& other)
+    static void append(variable_type& self, const U& other)
     {
         switch (self.code())
         {
@@ -1229,13 +1229,13 @@ struct string_overloader
     }
 };
 
-template <typename CharT, typename Traits, typename Allocator, typename U>
+template <typename T, typename U>
 struct string_overloader<
-    std::basic_string<CharT, Traits, Allocator>,
+    T,
     U,
-    typename std::enable_if<std::is_same<U, std::basic_string<CharT, Traits, Allocator>>::value>::type>
+    typename std::enable_if<std::is_same<U, T>::value>::type>
 {
-    using string_type = std::basic_string<CharT, Traits, Allocator>;
+    using string_type = T;
 
     static bool equal(const string_type& lhs, const U& rhs)
     {
@@ -3092,6 +3092,14 @@ auto basic_variable<Allocator>::operator= (const basic_variable& other) -> basic
 template <template <typename> class Allocator>
 auto basic_variable<Allocator>::operator= (basic_variable&& other) -> basic_variable&
 {
+    using allocator_traits = std::allocator_traits<allocator_type>;
+    if (!allocator_traits::propagate_on_container_move_assignment::value &&
+        (storage.get_allocator() != other.storage.get_allocator()))
+    {
+        // Memory cannot be transferred between unequal allocators
+        return *this = static_cast<const basic_variable&>(other);
+    }
+
     switch (other.code())
     {
     case code::null:
@@ -3305,6 +3313,60 @@ auto basic_variable<Allocator>::operator+= (const basic_variable& other) -> basi
     return *this;
 }
 
+template <template <typename> class Allocator>
+auto basic_variable<Allocator>::operator+= (basic_variable&& other) -> basic_variable&
+{
+    if (this == &other)
+        return operator+=(static_cast<const basic_variable&>(other));
+
+    switch (symbol())
+    {
+    case symbol::null:
+        // Overwrite null
+        *this = std::move(other);
+        return *this;
+
+    case symbol::array:
+        switch (other.symbol())
+        {
+        case symbol::null:
+            return *this;
+
+        case symbol::array:
+            {
+                auto& array = assume_value<array_type>();
+                auto& source = other.assume_value<array_type>();
+                array.insert(array.end(),
+                             std::make_move_iterator(source.begin()),
+                             std::make_move_iterator(source.end()));
+                return *this;
+            }
+
+        case symbol::map:
+            break;
+
+        default:
+            assume_value<array_type>().emplace_back(std::move(other));
+            return *this;
+        }
+        break;
+
+    case symbol::map:
+        if (other.symbol() == symbol::map)
+        {
+            auto& source = other.assume_value<map_type>();
+            assume_value<map_type>().insert(std::make_move_iterator(source.begin()),
+                                            std::make_move_iterator(source.end()));
+            return *this;
+        }
+        break;
+
+    default:
+        break;
+    }
+    return operator+=(static_cast<const basic_variable&>(other));
+}
+
 template <template <typename> class Allocator>
 auto basic_variable<Allocator>::operator+= (const char *other) -> basic_variable&
 {
@@ -3790,6 +3852,38 @@ auto basic_variable<Allocator>::insert(const basic_variable& value) -> iterator
     throw dynamic::error(incompatible_type);
 }
 
+template <template <typename> class Allocator>
+auto basic_variable<Allocator>::insert(basic_variable&& value) -> iterator
+{
+    switch (symbol())
+    {
+    case symbol::null:
+        *this = basic_array<Allocator>::make();
+        // FALLTHROUGH
+    case symbol::array:
+        {
+            // Insert at end
+            auto& array = assume_value<array_type>();
+            array.emplace_back(std::move(value));
+            return iterator(this, --array.end());
+        }
+
+    case symbol::map:
+        if (value.is_pair())
+        {
+            auto& pair = value.assume_value<array_type>();
+            auto result = assume_value<map_type>().emplace(std::move(pair[0]), std::move(pair[1]));
+            return iterator(this, std::move(result.first));
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    throw dynamic::error(incompatible_type);
+}
+
 template <template <typename> class Allocator>
 template <typename InputIterator>
 void basic_variable<Allocator>::insert(InputIterator begin,
@@ -3830,6 +3924,39 @@ auto basic_variable<Allocator>::insert(const_iterator where, const basic_variabl
     throw dynamic::error(incompatible_type);
 }
 
+template <template <typename> class Allocator>
+auto basic_variable<Allocator>::insert(const_iterator where, basic_variable&& value) -> iterator
+{
+    switch (symbol())
+    {
+    case symbol::array:
+        {
+            auto result = assume_value<array_type>()
+                .insert(where.current.template get<typename const_iterator::array_iterator>(),
+                        std::move(value));
+            return iterator(this, result);
+        }
+
+    case symbol::map:
+        if (value.is_pair())
+        {
+            // Use iterator as hint
+            auto& pair = value.assume_value<array_type>();
+            auto result = assume_value<map_type>()
+                .emplace_hint(where.current.template get<typename const_iterator::map_iterator>(),
+                              std::move(pair[0]),
+                              std::move(pair[1]));
+            return iterator(this, std::move(result));
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    throw dynamic::error(incompatible_type);
+}
+
 template <template <typename> class Allocator>
 template <typename InputIterator>
 void basic_variable<Allocator>::insert(const_iterator where,
@@ -0,0 +1,78 @@
+#ifndef TRIAL_DYNAMIC_FLAT_VARIABLE_HPP
+#define TRIAL_DYNAMIC_FLAT_VARIABLE_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <memory>
+#include <trial/dynamic/detail/flat_map.hpp>
+#include <trial/dynamic/variable.hpp>
+
+namespace trial
+{
+namespace dynamic
+{
+
+//! @brief Heap allocator that selects flat maps.
+//!
+//! Allocates like std::allocator. Variables instantiated with this allocator
+//! store maps as sorted vectors of key-value pairs instead of as trees.
+template <typename T>
+class flat_allocator : public std::allocator<T>
+{
+public:
+    template <typename U>
+    struct rebind
+    {
+        using other = flat_allocator<U>;
+    };
+
+    flat_allocator() noexcept = default;
+    flat_allocator(const flat_allocator&) noexcept = default;
+
+    template <typename U>
+    flat_allocator(const flat_allocator<U>&) noexcept {}
+};
+
+template <typename T, typename U>
+bool operator== (const flat_allocator<T>&, const flat_allocator<U>&) noexcept
+{
+    return true;
+}
+
+template <typename T, typename U>
+bool operator!= (const flat_allocator<T>&, const flat_allocator<U>&) noexcept
+{
+    return false;
+}
+
+template <>
+struct map_traits<flat_allocator>
+{
+    template <typename Key, typename T>
+    using type = detail::flat_map<Key,
+                                  T,
+                                  std::less<Key>,
+                                  flat_allocator<std::pair<Key, T>>>;
+};
+
+//! @brief Dynamic variable with maps stored in sorted vectors.
+//!
+//! Key lookups perform a binary search over contiguous memory and each map
+//! has a single allocation for all its entries. Insertion into a map takes
+//! linear time, and invalidates iterators into that map.
+using flat_variable = basic_variable<flat_allocator>;
+using flat_array = basic_array<flat_allocator>;
+using flat_map = basic_map<flat_allocator>;
+
+} // namespace dynamic
+} // namespace trial
+
+#endif // TRIAL_DYNAMIC_FLAT_VARIABLE_HPP
@@ -0,0 +1,77 @@
+#ifndef TRIAL_DYNAMIC_INTERNED_VARIABLE_HPP
+#define TRIAL_DYNAMIC_INTERNED_VARIABLE_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <memory>
+#include <trial/dynamic/detail/shared_string.hpp>
+#include <trial/dynamic/string_pool.hpp>
+#include <trial/dynamic/variable.hpp>
+
+namespace trial
+{
+namespace dynamic
+{
+
+//! @brief Heap allocator that selects shared strings.
+//!
+//! Allocates like std::allocator. Variables instantiated with this allocator
+//! store strings in reference-counted buffers, so copies of a string share
+//! the same characters.
+template <typename T>
+class interned_allocator : public std::allocator<T>
+{
+public:
+    template <typename U>
+    struct rebind
+    {
+        using other = interned_allocator<U>;
+    };
+
+    interned_allocator() noexcept = default;
+    interned_allocator(const interned_allocator&) noexcept = default;
+
+    template <typename U>
+    interned_allocator(const interned_allocator<U>&) noexcept {}
+};
+
+template <typename T, typename U>
+bool operator== (const interned_allocator<T>&, const interned_allocator<U>&) noexcept
+{
+    return true;
+}
+
+template <typename T, typename U>
+bool operator!= (const interned_allocator<T>&, const interned_allocator<U>&) noexcept
+{
+    return false;
+}
+
+template <>
+struct string_traits<interned_allocator>
+{
+    template <typename CharT>
+    using type = detail::basic_shared_string<CharT>;
+};
+
+//! @brief Dynamic variable with shared strings.
+//!
+//! Strings obtained from a string_pool share their storage, and map keys
+//! that share storage are compared by address. json::parse interns the keys
+//! of objects this way, so the keys of repeated records are stored once.
+using interned_variable = basic_variable<interned_allocator>;
+using interned_array = basic_array<interned_allocator>;
+using interned_map = basic_map<interned_allocator>;
+
+} // namespace dynamic
+} // namespace trial
+
+#endif // TRIAL_DYNAMIC_INTERNED_VARIABLE_HPP
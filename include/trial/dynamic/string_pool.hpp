@@ -0,0 +1,87 @@
+#ifndef TRIAL_DYNAMIC_STRING_POOL_HPP
+#define TRIAL_DYNAMIC_STRING_POOL_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <trial/dynamic/detail/shared_string.hpp>
+
+namespace trial
+{
+namespace dynamic
+{
+
+//! @brief Pool of interned strings.
+//!
+//! Strings with the same characters that are obtained from the same pool
+//! share a single buffer, so they occupy memory once and compare equal by
+//! address.
+//!
+//! Short strings are stored inline in the returned string and are not added
+//! to the pool, because copying them is cheaper than a lookup.
+//!
+//! Strings obtained from the pool remain valid after the pool is cleared or
+//! destroyed. The pool is not thread-safe.
+template <typename CharT>
+class basic_string_pool
+{
+public:
+    using value_type = CharT;
+    using size_type = std::size_t;
+    using string_type = detail::basic_shared_string<CharT>;
+
+    //! @brief Get string with shared storage.
+    //!
+    //! @param[in] data Pointer to the characters.
+    //! @param[in] size Number of characters.
+    //! @returns String that shares its buffer with all other strings of the
+    //!          same characters obtained from the pool.
+    string_type intern(const value_type *data, size_type size);
+
+    //! @returns Number of strings in the pool.
+    size_type size() const noexcept;
+
+    //! @brief Remove all strings from the pool.
+    void clear() noexcept;
+
+#ifndef BOOST_DOXYGEN_INVOKED
+private:
+    // View into the buffer of the pooled string
+    struct key_type
+    {
+        const value_type *data;
+        size_type size;
+    };
+
+    struct key_hash
+    {
+        std::size_t operator() (const key_type&) const noexcept;
+    };
+
+    struct key_equal
+    {
+        bool operator() (const key_type&, const key_type&) const noexcept;
+    };
+
+    std::unordered_map<key_type, string_type, key_hash, key_equal> strings;
+#endif
+};
+
+using string_pool = basic_string_pool<char>;
+
+} // namespace dynamic
+} // namespace trial
+
+#include <trial/dynamic/detail/string_pool.ipp>
+
+#endif // TRIAL_DYNAMIC_STRING_POOL_HPP
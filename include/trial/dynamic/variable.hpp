@@ -15,6 +15,7 @@
 #include <cstdint>
 #include <memory>
 #include <iterator>
+#include <type_traits>
 #include <string>
 #include <vector>
 #include <map>
@@ -51,6 +52,35 @@ struct u32string {};
 template <template <typename> class Allocator> struct basic_array;
 template <template <typename> class Allocator> struct basic_map;
 
+//! @brief Selects the associative container used for maps.
+//!
+//! The container is std::map by default. The trait can be specialized for an
+//! allocator to select another container with the std::map interface, such as
+//! the sorted vector used by flat_variable.
+template <template <typename> class Allocator>
+struct map_traits
+{
+    template <typename Key, typename T>
+    using type = std::map<Key,
+                          T,
+                          std::less<Key>,
+                          typename std::allocator_traits<Allocator<T>>::template rebind_alloc<std::pair<const Key, T>>>;
+};
+
+//! @brief Selects the string types.
+//!
+//! The string types are std::basic_string by default. The trait can be
+//! specialized for an allocator to select another string type with the same
+//! value semantics, such as the shared strings used by interned_variable.
+template <template <typename> class Allocator>
+struct string_traits
+{
+    template <typename CharT>
+    using type = std::basic_string<CharT,
+                                   std::char_traits<CharT>,
+                                   typename std::allocator_traits<Allocator<CharT>>::template rebind_alloc<CharT>>;
+};
+
 //! @brief Dynamic variable.
 //!
 //! Dynamic variable is a tagged union that can change both its type and value
@@ -118,10 +148,7 @@ public:
     using size_type = std::size_t;
 private:
     template <typename CharT>
-    using basic_string = std::basic_string<CharT,
-                                           typename std::char_traits<CharT>,
-                                           typename std::allocator_traits<allocator_type>::template rebind_alloc<CharT>>;
-    using map_value_type = typename std::map<value_type, value_type>::value_type;
+    using basic_string = typename string_traits<Allocator>::template type<CharT>;
 public:
     using string_type = basic_string<char>;
     using wstring_type = basic_string<wchar_t>;
@@ -129,10 +156,7 @@ public:
     using u32string_type = basic_string<char32_t>;
     using array_type = std::vector<value_type,
                                    allocator_type>;
-    using map_type = std::map<value_type,
-                              value_type,
-                              std::less<value_type>,
-                              typename std::allocator_traits<allocator_type>::template rebind_alloc<map_value_type>>;
+    using map_type = typename map_traits<Allocator>::template type<value_type, value_type>;
     using pair_type = typename map_type::value_type;
 
 #endif
@@ -469,6 +493,13 @@ public:
 
     basic_variable& operator+= (const basic_variable&);
 
+    //! @overload basic_variable<Allocator>::operator+=(const basic_variable&)
+    //!
+    //! Elements are moved rather than copied when @c other is appended to or
+    //! merged into a container, or when it overwrites null.
+
+    basic_variable& operator+= (basic_variable&& other);
+
     //! @overload basic_variable<Allocator>::operator+=(const basic_variable&)
 
     template <typename T> basic_variable& operator+= (const T&);
@@ -808,6 +839,12 @@ public:
 
     iterator insert(const basic_variable& element);
 
+    //! @overload basic_variable<Allocator>::insert(const basic_variable&)
+    //!
+    //! The element, or the key and value of a pair, is moved into the variable.
+
+    iterator insert(basic_variable&& element);
+
     //! @brief Inserts range into variable.
     //!
     //! Current tag | Behavior
@@ -843,6 +880,12 @@ public:
 
     iterator insert(const_iterator position, const basic_variable& element);
 
+    //! @overload basic_variable<Allocator>::insert(const_iterator, const basic_variable&)
+    //!
+    //! The element, or the key and value of a pair, is moved into the variable.
+
+    iterator insert(const_iterator position, basic_variable&& element);
+
     //! @brief Inserts range into variable.
     //!
     //! Current tag | Behavior
@@ -976,8 +1019,17 @@ private:
     template <typename T> struct similar_visitor;
 
     using index_type = unsigned char;
+    // The storage is large enough to hold the string types directly, so
+    // short strings fit into their small-string buffer without any heap
+    // allocation. Larger types are placed on the heap.
+    using max_type = typename std::aligned_union<0,
+                                                 std::max_align_t,
+                                                 string_type,
+                                                 wstring_type,
+                                                 u16string_type,
+                                                 u32string_type>::type;
     using storage_type = detail::small_union<allocator_type,
-                                             std::max_align_t,
+                                             max_type,
                                              index_type,
                                              nullable,
                                              bool,
@@ -18,6 +18,7 @@
 #include <trial/protocol/core/detail/string_view.hpp>
 #include <trial/protocol/core/char_traits.hpp>
 #include <trial/protocol/buffer/base.hpp>
+#include <trial/protocol/buffer/detail/storage.hpp>
 #include <trial/protocol/bintoken/token.hpp>
 
 namespace trial
@@ -29,19 +30,21 @@ namespace bintoken
 namespace detail
 {
 
-template <std::size_t N>
+// The encoder writes into a type-erased buffer if OutputType is void, and
+// directly into a buffer for OutputType otherwise.
+template <std::size_t N, typename OutputType = void>
 class basic_encoder
 {
     using value_type = std::uint8_t;
+    using storage_type = buffer::detail::storage<value_type, N, OutputType>;
 public:
     using size_type = std::size_t;
-    using buffer_type = buffer::base<value_type>;
+    using buffer_type = typename storage_type::buffer_type;
     using view_type = core::detail::basic_string_view<value_type, core::char_traits<value_type>>;
     using string_view_type = core::detail::basic_string_view<char, core::char_traits<char>>;
 
     template <typename T>
     basic_encoder(T&);
-    ~basic_encoder();
 
     template <typename T> size_type value();
     size_type value(bool);
@@ -82,12 +85,14 @@ private:
     void endian_write(std::uint16_t);
     void endian_write(std::uint32_t);
     void endian_write(std::uint64_t);
+    template <typename T>
+    void endian_write(const T *, size_type);
 
     buffer_type& buffer();
     const buffer_type& buffer() const;
 
 private:
-    typename std::aligned_storage<N>::type storage;
+    storage_type storage;
 };
 
 } // namespace detail
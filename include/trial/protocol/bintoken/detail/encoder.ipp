@@ -11,10 +11,11 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
 #include <limits>
-#include <trial/protocol/buffer/base.hpp>
 #include <trial/protocol/bintoken/token.hpp>
 #include <trial/protocol/bintoken/error.hpp>
+#include <trial/protocol/bintoken/detail/endian.hpp>
 
 namespace trial
 {
@@ -33,106 +34,106 @@ struct static_assert_t;
 // encoder::overloader
 //-----------------------------------------------------------------------------
 
-template <std::size_t N>
+template <std::size_t N, typename OutputType>
 template <typename T, typename>
-struct basic_encoder<N>::overloader
+struct basic_encoder<N, OutputType>::overloader
 {
     static_assert_t<T> unsupported_type;
 };
 
-template <std::size_t N>
+template <std::size_t N, typename OutputType>
 template <typename T>
-struct basic_encoder<N>::overloader<
+struct basic_encoder<N, OutputType>::overloader<
     T,
     typename std::enable_if<std::is_same<T, token::null>::value>::type>
 {
-    using size_type = typename basic_encoder<N>::size_type;
+    using size_type = typename basic_encoder<N, OutputType>::size_type;
 
-    static size_type write(basic_encoder<N>& self)
+    static size_type write(basic_encoder<N, OutputType>& self)
     {
         return self.write(token::null::code);
     }
 };
 
-template <std::size_t N>
+template <std::size_t N, typename OutputType>
 template <typename T>
-struct basic_encoder<N>::overloader<
+struct basic_encoder<N, OutputType>::overloader<
     T,
     typename std::enable_if<std::is_same<T, token::begin_record>::value>::type>
 {
-    using size_type = typename basic_encoder<N>::size_type;
+    using size_type = typename basic_encoder<N, OutputType>::size_type;
 
-    static size_type write(basic_encoder<N>& self)
+    static size_type write(basic_encoder<N, OutputType>& self)
     {
         return self.write(token::begin_record::code);
     }
 };
 
-template <std::size_t N>
+template <std::size_t N, typename OutputType>
 template <typename T>
-struct basic_encoder<N>::overloader<
+struct basic_encoder<N, OutputType>::overloader<
     T,
     typename std::enable_if<std::is_same<T, token::end_record>::value>::type>
 {
-    using size_type = typename basic_encoder<N>::size_type;
+    using size_type = typename basic_encoder<N, OutputType>::size_type;
 
-    static size_type write(basic_encoder<N>& self)
+    static size_type write(basic_encoder<N, OutputType>& self)
     {
         return self.write(token::end_record::code);
     }
 };
 
-template <std::size_t N>
+template <std::size_t N, typename OutputType>
 template <typename T>
-struct basic_encoder<N>::overloader<
+struct basic_encoder<N, OutputType>::overloader<
     T,
     typename std::enable_if<std::is_same<T, token::begin_array>::value>::type>
 {
-    using size_type = typename basic_encoder<N>::size_type;
+    using size_type = typename basic_encoder<N, OutputType>::size_type;
 
-    static size_type write(basic_encoder<N>& self)
+    static size_type write(basic_encoder<N, OutputType>& self)
     {
         return self.write(token::begin_array::code);
     }
 };
 
-template <std::size_t N>
+template <std::size_t N, typename OutputType>
 template <typename T>
-struct basic_encoder<N>::overloader<
+struct basic_encoder<N, OutputType>::overloader<
     T,
     typename std::enable_if<std::is_same<T, token::end_array>::value>::type>
 {
-    using size_type = typename basic_encoder<N>::size_type;
+    using size_type = typename basic_encoder<N, OutputType>::size_type;
 
-    static size_type write(basic_encoder<N>& self)
+    static size_type write(basic_encoder<N, OutputType>& self)
     {
         return self.write(token::end_array::code);
     }
 };
 
-template <std::size_t N>
+template <std::size_t N, typename OutputType>
 template <typename T>
-struct basic_encoder<N>::overloader<
+struct basic_encoder<N, OutputType>::overloader<
     T,
     typename std::enable_if<std::is_same<T, token::begin_assoc_array>::value>::type>
 {
-    using size_type = typename basic_encoder<N>::size_type;
+    using size_type = typename basic_encoder<N, OutputType>::size_type;
 
-    static size_type write(basic_encoder<N>& self)
+    static size_type write(basic_encoder<N, OutputType>& self)
     {
         return self.write(token::begin_assoc_array::code);
     }
 };
 
-template <std::size_t N>
+template <std::size_t N, typename OutputType>
 template <typename T>
-struct basic_encoder<N>::overloader<
+struct basic_encoder<N, OutputType>::overloader<
     T,
     typename std::enable_if<std::is_same<T, token::end_assoc_array>::value>::type>
 {
-    using size_type = typename basic_encoder<N>::size_type;
+    using size_type = typename basic_encoder<N, OutputType>::size_type;
 
-    static size_type write(basic_encoder<N>& self)
+    static size_type write(basic_encoder<N, OutputType>& self)
     {
         return self.write(token::end_assoc_array::code);
     }
@@ -142,37 +143,28 @@ struct basic_encoder<N>::overloader<
 // encoder
 //-----------------------------------------------------------------------------
 
-template <std::size_t N>
+template <std::size_t N, typename OutputType>
 template <typename T>
-basic_encoder<N>::basic_encoder(T& output)
+basic_encoder<N, OutputType>::basic_encoder(T& output)
+    : storage(output)
 {
-    static_assert(N >= sizeof(typename buffer::traits<T>::buffer_type),
-                  "N is smaller than buffer_type");
-
-    ::new (std::addressof(storage)) typename buffer::traits<T>::buffer_type(output);
 }
 
-template <std::size_t N>
-basic_encoder<N>::~basic_encoder()
-{
-    buffer().~buffer_type();
-}
-
-template <std::size_t N>
+template <std::size_t N, typename OutputType>
 template <typename U>
-auto basic_encoder<N>::value() -> size_type
+auto basic_encoder<N, OutputType>::value() -> size_type
 {
     return overloader<U>::write(*this);
 }
 
-template <std::size_t N>
-auto basic_encoder<N>::value(bool data) -> size_type
+template <std::size_t N, typename OutputType>
+auto basic_encoder<N, OutputType>::value(bool data) -> size_type
 {
     return write(data ? token::code::true_value : token::code::false_value);
 }
 
-template <std::size_t N>
-auto basic_encoder<N>::value(token::int8::type data) -> size_type
+template <std::size_t N, typename OutputType>
+auto basic_encoder<N, OutputType>::value(token::int8::type data) -> size_type
 {
     if (data >= -32)
     {
@@ -192,8 +184,8 @@ auto basic_encoder<N>::value(token::int8::type data) -> size_type
     return 0;
 }
 
-template <std::size_t N>
-auto basic_encoder<N>::value(token::int16::type data) -> size_type
+template <std::size_t N, typename OutputType>
+auto basic_encoder<N, OutputType>::value(token::int16::type data) -> size_type
 {
     const value_type token(token::int16::code);
     const size_type size = sizeof(token) + sizeof(std::int16_t);
@@ -206,8 +198,8 @@ auto basic_encoder<N>::value(token::int16::type data) -> size_type
     return 0;
 }
 
-template <std::size_t N>
-auto basic_encoder<N>::value(token::int32::type data) -> size_type
+template <std::size_t N, typename OutputType>
+auto basic_encoder<N, OutputType>::value(token::int32::type data) -> size_type
 {
     const value_type token(token::int32::code);
     const size_type size = sizeof(token) + sizeof(std::int32_t);
@@ -220,8 +212,8 @@ auto basic_encoder<N>::value(token::int32::type data) -> size_type
     return 0;
 }
 
-template <std::size_t N>
-auto basic_encoder<N>::value(token::int64::type data) -> size_type
+template <std::size_t N, typename OutputType>
+auto basic_encoder<N, OutputType>::value(token::int64::type data) -> size_type
 {
     const value_type token(token::int64::code);
     const size_type size = sizeof(token) + sizeof(std::int64_t);
@@ -234,8 +226,8 @@ auto basic_encoder<N>::value(token::int64::type data) -> size_type
     return 0;
 }
 
-template <std::size_t N>
-auto basic_encoder<N>::value(token::float32::type data) -> size_type
+template <std::size_t N, typename OutputType>
+auto basic_encoder<N, OutputType>::value(token::float32::type data) -> size_type
 {
     // IEEE 754 single precision
     const value_type token(token::float32::code);
@@ -249,8 +241,8 @@ auto basic_encoder<N>::value(token::float32::type data) -> size_type
     return 0;
 }
 
-template <std::size_t N>
-auto basic_encoder<N>::value(token::float64::type data) -> size_type
+template <std::size_t N, typename OutputType>
+auto basic_encoder<N, OutputType>::value(token::float64::type data) -> size_type
 {
     // IEEE 754 double precision
     const value_type token(token::float64::code);
@@ -264,8 +256,8 @@ auto basic_encoder<N>::value(token::float64::type data) -> size_type
     return 0;
 }
 
-template <std::size_t N>
-auto basic_encoder<N>::value(const string_view_type& data) -> size_type
+template <std::size_t N, typename OutputType>
+auto basic_encoder<N, OutputType>::value(const string_view_type& data) -> size_type
 {
     const std::string::size_type length = data.size();
     size_type size = 0;
@@ -304,21 +296,21 @@ auto basic_encoder<N>::value(const string_view_type& data) -> size_type
     return sizeof(value_type) + size + length;
 }
 
-template <std::size_t N>
-auto basic_encoder<N>::value(const char *data,
+template <std::size_t N, typename OutputType>
+auto basic_encoder<N, OutputType>::value(const char *data,
                              size_type size) -> size_type
 {
     return value(string_view_type(data, size));
 }
 
-template <std::size_t N>
-auto basic_encoder<N>::value(const char *data) -> size_type
+template <std::size_t N, typename OutputType>
+auto basic_encoder<N, OutputType>::value(const char *data) -> size_type
 {
     return value(string_view_type(data));
 }
 
-template <std::size_t N>
-auto basic_encoder<N>::array(const token::int8::type *data,
+template <std::size_t N, typename OutputType>
+auto basic_encoder<N, OutputType>::array(const token::int8::type *data,
                              size_type length) -> size_type
 {
     size_type size = 0;
@@ -358,8 +350,8 @@ auto basic_encoder<N>::array(const token::int8::type *data,
     return sizeof(value_type) + size + length;
 }
 
-template <std::size_t N>
-auto basic_encoder<N>::array(const token::int16::type *data,
+template <std::size_t N, typename OutputType>
+auto basic_encoder<N, OutputType>::array(const token::int16::type *data,
                              size_type length) -> size_type
 {
     size_type size = 0;
@@ -396,15 +388,12 @@ auto basic_encoder<N>::array(const token::int16::type *data,
         size = write_length(static_cast<std::uint64_t>(length_size));
     }
 
-    for (size_type i = 0; i < length; ++i)
-    {
-        endian_write(data[i]);
-    }
+    endian_write(data, length);
     return sizeof(value_type) + size + length_size;
 }
 
-template <std::size_t N>
-auto basic_encoder<N>::array(const token::int32::type *data,
+template <std::size_t N, typename OutputType>
+auto basic_encoder<N, OutputType>::array(const token::int32::type *data,
                              size_type length) -> size_type
 {
     size_type size = 0;
@@ -441,15 +430,12 @@ auto basic_encoder<N>::array(const token::int32::type *data,
         size = write_length(static_cast<std::uint64_t>(length_size));
     }
 
-    for (size_type i = 0; i < length; ++i)
-    {
-        endian_write(data[i]);
-    }
+    endian_write(data, length);
     return sizeof(value_type) + size + length_size;
 }
 
-template <std::size_t N>
-auto basic_encoder<N>::array(const token::int64::type *data,
+template <std::size_t N, typename OutputType>
+auto basic_encoder<N, OutputType>::array(const token::int64::type *data,
                              size_type length) -> size_type
 {
     size_type size = 0;
@@ -486,15 +472,12 @@ auto basic_encoder<N>::array(const token::int64::type *data,
         size = write_length(static_cast<std::uint64_t>(length_size));
     }
 
-    for (size_type i = 0; i < length; ++i)
-    {
-        endian_write(data[i]);
-    }
+    endian_write(data, length);
     return sizeof(value_type) + size + length_size;
 }
 
-template <std::size_t N>
-auto basic_encoder<N>::array(const token::float32::type *data,
+template <std::size_t N, typename OutputType>
+auto basic_encoder<N, OutputType>::array(const token::float32::type *data,
                              size_type length) -> size_type
 {
     size_type size = 0;
@@ -531,15 +514,12 @@ auto basic_encoder<N>::array(const token::float32::type *data,
         size = write_length(static_cast<std::uint64_t>(length_size));
     }
 
-    for (size_type i = 0; i < length; ++i)
-    {
-        endian_write(data[i]);
-    }
+    endian_write(data, length);
     return sizeof(value_type) + size + length_size;
 }
 
-template <std::size_t N>
-auto basic_encoder<N>::array(const token::float64::type *data,
+template <std::size_t N, typename OutputType>
+auto basic_encoder<N, OutputType>::array(const token::float64::type *data,
                              size_type length) -> size_type
 {
     size_type size = 0;
@@ -576,21 +556,18 @@ auto basic_encoder<N>::array(const token::float64::type *data,
         size = write_length(static_cast<std::uint64_t>(length_size));
     }
 
-    for (size_type i = 0; i < length; ++i)
-    {
-        endian_write(data[i]);
-    }
+    endian_write(data, length);
     return sizeof(value_type) + size + length_size;
 }
 
-template <std::size_t N>
-auto basic_encoder<N>::write_length(std::uint8_t data) -> size_type
+template <std::size_t N, typename OutputType>
+auto basic_encoder<N, OutputType>::write_length(std::uint8_t data) -> size_type
 {
     return write(data);
 }
 
-template <std::size_t N>
-auto basic_encoder<N>::write_length(std::uint16_t data) -> size_type
+template <std::size_t N, typename OutputType>
+auto basic_encoder<N, OutputType>::write_length(std::uint16_t data) -> size_type
 {
     const size_type size = sizeof(std::int16_t);
     if (buffer().grow(size))
@@ -601,8 +578,8 @@ auto basic_encoder<N>::write_length(std::uint16_t data) -> size_type
     return 0;
 }
 
-template <std::size_t N>
-auto basic_encoder<N>::write_length(std::uint32_t data) -> size_type
+template <std::size_t N, typename OutputType>
+auto basic_encoder<N, OutputType>::write_length(std::uint32_t data) -> size_type
 {
     const size_type size = sizeof(std::int32_t);
     if (buffer().grow(size))
@@ -613,8 +590,8 @@ auto basic_encoder<N>::write_length(std::uint32_t data) -> size_type
     return 0;
 }
 
-template <std::size_t N>
-auto basic_encoder<N>::write_length(std::uint64_t data) -> size_type
+template <std::size_t N, typename OutputType>
+auto basic_encoder<N, OutputType>::write_length(std::uint64_t data) -> size_type
 {
     const size_type size = sizeof(std::int64_t);
     if (buffer().grow(size))
@@ -625,8 +602,8 @@ auto basic_encoder<N>::write_length(std::uint64_t data) -> size_type
     return 0;
 }
 
-template <std::size_t N>
-auto basic_encoder<N>::write(value_type data) -> size_type
+template <std::size_t N, typename OutputType>
+auto basic_encoder<N, OutputType>::write(value_type data) -> size_type
 {
     const size_type size = sizeof(data);
     if (buffer().grow(size))
@@ -637,8 +614,8 @@ auto basic_encoder<N>::write(value_type data) -> size_type
     return 0;
 }
 
-template <std::size_t N>
-auto basic_encoder<N>::write(const view_type& data) -> size_type
+template <std::size_t N, typename OutputType>
+auto basic_encoder<N, OutputType>::write(const view_type& data) -> size_type
 {
     const size_type size = data.size();
     if (buffer().grow(size))
@@ -649,112 +626,85 @@ auto basic_encoder<N>::write(const view_type& data) -> size_type
     return 0;
 }
 
-template <std::size_t N>
-void basic_encoder<N>::endian_write(std::int16_t data)
+template <std::size_t N, typename OutputType>
+void basic_encoder<N, OutputType>::endian_write(std::int16_t data)
+{
+    endian_write(&data, 1);
+}
+
+template <std::size_t N, typename OutputType>
+void basic_encoder<N, OutputType>::endian_write(std::uint16_t data)
 {
-    const std::uint16_t endian = UINT16_C(0x0100);
-    value_type *data_buffer = (value_type *)&data;
-    buffer().write(static_cast<value_type>(data_buffer[((value_type *)&endian)[0]]));
-    buffer().write(static_cast<value_type>(data_buffer[((value_type *)&endian)[1]]));
+    endian_write(&data, 1);
 }
 
-template <std::size_t N>
-void basic_encoder<N>::endian_write(std::uint16_t data)
+template <std::size_t N, typename OutputType>
+void basic_encoder<N, OutputType>::endian_write(std::int32_t data)
 {
-    const std::uint16_t endian = UINT16_C(0x0100);
-    value_type *data_buffer = (value_type *)&data;
-    buffer().write(static_cast<value_type>(data_buffer[((value_type *)&endian)[0]]));
-    buffer().write(static_cast<value_type>(data_buffer[((value_type *)&endian)[1]]));
+    endian_write(&data, 1);
 }
 
-template <std::size_t N>
-void basic_encoder<N>::endian_write(std::int32_t data)
+template <std::size_t N, typename OutputType>
+void basic_encoder<N, OutputType>::endian_write(std::uint32_t data)
 {
-    const std::uint32_t endian = UINT32_C(0x03020100);
-    value_type *data_buffer = (value_type *)&data;
-    buffer().write(static_cast<value_type>(data_buffer[((value_type *)&endian)[0]]));
-    buffer().write(static_cast<value_type>(data_buffer[((value_type *)&endian)[1]]));
-    buffer().write(static_cast<value_type>(data_buffer[((value_type *)&endian)[2]]));
-    buffer().write(static_cast<value_type>(data_buffer[((value_type *)&endian)[3]]));
+    endian_write(&data, 1);
 }
 
-template <std::size_t N>
-void basic_encoder<N>::endian_write(std::uint32_t data)
+template <std::size_t N, typename OutputType>
+void basic_encoder<N, OutputType>::endian_write(std::int64_t data)
 {
-    const std::uint32_t endian = UINT32_C(0x03020100);
-    value_type *data_buffer = (value_type *)&data;
-    buffer().write(static_cast<value_type>(data_buffer[((value_type *)&endian)[0]]));
-    buffer().write(static_cast<value_type>(data_buffer[((value_type *)&endian)[1]]));
-    buffer().write(static_cast<value_type>(data_buffer[((value_type *)&endian)[2]]));
-    buffer().write(static_cast<value_type>(data_buffer[((value_type *)&endian)[3]]));
+    endian_write(&data, 1);
 }
 
-template <std::size_t N>
-void basic_encoder<N>::endian_write(std::int64_t data)
+template <std::size_t N, typename OutputType>
+void basic_encoder<N, OutputType>::endian_write(std::uint64_t data)
 {
-    const std::uint64_t endian = UINT64_C(0x0706050403020100);
-    value_type *data_buffer = (value_type *)&data;
-    buffer().write(static_cast<value_type>(data_buffer[((value_type *)&endian)[0]]));
-    buffer().write(static_cast<value_type>(data_buffer[((value_type *)&endian)[1]]));
-    buffer().write(static_cast<value_type>(data_buffer[((value_type *)&endian)[2]]));
-    buffer().write(static_cast<value_type>(data_buffer[((value_type *)&endian)[3]]));
-    buffer().write(static_cast<value_type>(data_buffer[((value_type *)&endian)[4]]));
-    buffer().write(static_cast<value_type>(data_buffer[((value_type *)&endian)[5]]));
-    buffer().write(static_cast<value_type>(data_buffer[((value_type *)&endian)[6]]));
-    buffer().write(static_cast<value_type>(data_buffer[((value_type *)&endian)[7]]));
+    endian_write(&data, 1);
 }
 
-template <std::size_t N>
-void basic_encoder<N>::endian_write(std::uint64_t data)
+template <std::size_t N, typename OutputType>
+void basic_encoder<N, OutputType>::endian_write(token::float32::type data)
 {
-    const std::uint64_t endian = UINT64_C(0x0706050403020100);
-    value_type *data_buffer = (value_type *)&data;
-    buffer().write(static_cast<value_type>(data_buffer[((value_type *)&endian)[0]]));
-    buffer().write(static_cast<value_type>(data_buffer[((value_type *)&endian)[1]]));
-    buffer().write(static_cast<value_type>(data_buffer[((value_type *)&endian)[2]]));
-    buffer().write(static_cast<value_type>(data_buffer[((value_type *)&endian)[3]]));
-    buffer().write(static_cast<value_type>(data_buffer[((value_type *)&endian)[4]]));
-    buffer().write(static_cast<value_type>(data_buffer[((value_type *)&endian)[5]]));
-    buffer().write(static_cast<value_type>(data_buffer[((value_type *)&endian)[6]]));
-    buffer().write(static_cast<value_type>(data_buffer[((value_type *)&endian)[7]]));
+    endian_write(&data, 1);
 }
 
-template <std::size_t N>
-void basic_encoder<N>::endian_write(token::float32::type data)
+template <std::size_t N, typename OutputType>
+void basic_encoder<N, OutputType>::endian_write(token::float64::type data)
 {
-    const std::uint32_t endian = UINT32_C(0x03020100);
-    value_type *data_buffer = (value_type *)&data;
-    buffer().write(static_cast<value_type>(data_buffer[((value_type *)&endian)[0]]));
-    buffer().write(static_cast<value_type>(data_buffer[((value_type *)&endian)[1]]));
-    buffer().write(static_cast<value_type>(data_buffer[((value_type *)&endian)[2]]));
-    buffer().write(static_cast<value_type>(data_buffer[((value_type *)&endian)[3]]));
+    endian_write(&data, 1);
 }
 
-template <std::size_t N>
-void basic_encoder<N>::endian_write(token::float64::type data)
+template <std::size_t N, typename OutputType>
+template <typename T>
+void basic_encoder<N, OutputType>::endian_write(const T *data, size_type length)
 {
-    const std::uint64_t endian = UINT64_C(0x0706050403020100);
-    value_type *data_buffer = (value_type *)&data;
-    buffer().write(static_cast<value_type>(data_buffer[((value_type *)&endian)[0]]));
-    buffer().write(static_cast<value_type>(data_buffer[((value_type *)&endian)[1]]));
-    buffer().write(static_cast<value_type>(data_buffer[((value_type *)&endian)[2]]));
-    buffer().write(static_cast<value_type>(data_buffer[((value_type *)&endian)[3]]));
-    buffer().write(static_cast<value_type>(data_buffer[((value_type *)&endian)[4]]));
-    buffer().write(static_cast<value_type>(data_buffer[((value_type *)&endian)[5]]));
-    buffer().write(static_cast<value_type>(data_buffer[((value_type *)&endian)[6]]));
-    buffer().write(static_cast<value_type>(data_buffer[((value_type *)&endian)[7]]));
+#if BOOST_ENDIAN_LITTLE_BYTE
+    buffer().write(view_type(reinterpret_cast<const value_type *>(data), length * sizeof(T)));
+#else
+    // Convert in chunks to avoid allocating a temporary for the whole array
+    value_type chunk[256];
+    const size_type chunk_length = sizeof(chunk) / sizeof(T);
+    while (length > 0)
+    {
+        const size_type count = std::min(length, chunk_length);
+        endian::encode_array(data, chunk, count);
+        buffer().write(view_type(chunk, count * sizeof(T)));
+        data += count;
+        length -= count;
+    }
+#endif
 }
 
-template <std::size_t N>
-auto basic_encoder<N>::buffer() -> buffer_type&
+template <std::size_t N, typename OutputType>
+auto basic_encoder<N, OutputType>::buffer() -> buffer_type&
 {
-    return reinterpret_cast<buffer_type&>(storage);
+    return storage.get();
 }
 
-template <std::size_t N>
-auto basic_encoder<N>::buffer() const -> const buffer_type&
+template <std::size_t N, typename OutputType>
+auto basic_encoder<N, OutputType>::buffer() const -> const buffer_type&
 {
-    return reinterpret_cast<const buffer_type&>(storage);
+    return storage.get();
 }
 
 } // namespace detail
@@ -0,0 +1,112 @@
+#ifndef TRIAL_PROTOCOL_BINTOKEN_DETAIL_ENDIAN_HPP
+#define TRIAL_PROTOCOL_BINTOKEN_DETAIL_ENDIAN_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef> // std::size_t
+#include <cstdint>
+#include <cstring> // std::memcpy
+#include <boost/config.hpp>
+#include <boost/predef/other/endian.h>
+
+// Numbers are stored in little-endian byte order in the bintoken format.
+
+namespace trial
+{
+namespace protocol
+{
+namespace bintoken
+{
+namespace detail
+{
+namespace endian
+{
+
+inline std::uint16_t byteswap(std::uint16_t value) BOOST_NOEXCEPT
+{
+    return std::uint16_t((value << 8) | (value >> 8));
+}
+
+inline std::uint32_t byteswap(std::uint32_t value) BOOST_NOEXCEPT
+{
+    value = ((value << 8) & UINT32_C(0xFF00FF00)) | ((value >> 8) & UINT32_C(0x00FF00FF));
+    return (value << 16) | (value >> 16);
+}
+
+inline std::uint64_t byteswap(std::uint64_t value) BOOST_NOEXCEPT
+{
+    value = ((value << 8) & UINT64_C(0xFF00FF00FF00FF00)) | ((value >> 8) & UINT64_C(0x00FF00FF00FF00FF));
+    value = ((value << 16) & UINT64_C(0xFFFF0000FFFF0000)) | ((value >> 16) & UINT64_C(0x0000FFFF0000FFFF));
+    return (value << 32) | (value >> 32);
+}
+
+template <std::size_t Size> struct word;
+template <> struct word<2> { using type = std::uint16_t; };
+template <> struct word<4> { using type = std::uint32_t; };
+template <> struct word<8> { using type = std::uint64_t; };
+
+// Copy length elements of Size bytes and reverse the byte order of each.
+//
+// The loop has no dependencies between iterations and only uses shifts and
+// masks, so the compiler turns it into a vector byte shuffle.
+template <std::size_t Size>
+void byteswap_copy(const void *input,
+                   void *output,
+                   std::size_t length) BOOST_NOEXCEPT
+{
+    using word_type = typename word<Size>::type;
+
+    auto first = static_cast<const std::uint8_t *>(input);
+    auto result = static_cast<std::uint8_t *>(output);
+    for (std::size_t i = 0; i < length; ++i)
+    {
+        word_type value;
+        std::memcpy(&value, first + i * Size, Size);
+        value = byteswap(value);
+        std::memcpy(result + i * Size, &value, Size);
+    }
+}
+
+// Convert array from bintoken byte order into native byte order.
+//
+// The input buffer need not be aligned.
+template <typename T>
+void decode_array(const std::uint8_t *input,
+                  T *output,
+                  std::size_t length) BOOST_NOEXCEPT
+{
+#if BOOST_ENDIAN_LITTLE_BYTE
+    std::memcpy(output, input, length * sizeof(T));
+#else
+    byteswap_copy<sizeof(T)>(input, output, length);
+#endif
+}
+
+// Convert array from native byte order into bintoken byte order.
+template <typename T>
+void encode_array(const T *input,
+                  std::uint8_t *output,
+                  std::size_t length) BOOST_NOEXCEPT
+{
+#if BOOST_ENDIAN_LITTLE_BYTE
+    std::memcpy(output, input, length * sizeof(T));
+#else
+    byteswap_copy<sizeof(T)>(input, output, length);
+#endif
+}
+
+} // namespace endian
+} // namespace detail
+} // namespace bintoken
+} // namespace protocol
+} // namespace trial
+
+#endif // TRIAL_PROTOCOL_BINTOKEN_DETAIL_ENDIAN_HPP
@@ -28,6 +28,7 @@ class basic_parser
 {
 public:
     using variable_type = dynamic::basic_variable<Allocator>;
+    using map_type = typename variable_type::map_type;
 
     basic_parser(bintoken::reader& reader)
         : reader(reader)
@@ -182,11 +183,13 @@ private:
         assert(reader.symbol() == token::symbol::begin_assoc_array);
 
         auto scope = dynamic::basic_map<Allocator>::make();
+        // Members are moved directly into the map
+        auto& members = scope.template assume_value<map_type>();
 
         while (reader.next())
         {
             // Key
-            dynamic::variable key;
+            variable_type key;
             switch (reader.symbol())
             {
             case token::symbol::end_assoc_array:
@@ -210,18 +213,18 @@ private:
             switch (reader.symbol())
             {
             case token::symbol::begin_record:
-                scope.insert({ std::move(key), parse_record() });
+                members.emplace(std::move(key), parse_record());
                 break;
 
             case token::symbol::end_record:
                 throw bintoken::error(make_error_code(bintoken::unexpected_token));
 
             case token::symbol::begin_array:
-                scope.insert({ std::move(key), parse_array() });
+                members.emplace(std::move(key), parse_array());
                 break;
 
             case token::symbol::begin_assoc_array:
-                scope.insert({ std::move(key), parse_assoc_array() });
+                members.emplace(std::move(key), parse_assoc_array());
                 break;
 
             case token::symbol::end_array:
@@ -235,7 +238,7 @@ private:
                 break;
 
             default:
-                scope.insert({ std::move(key), parse_value() });
+                members.emplace(std::move(key), parse_value());
                 break;
             }
         }
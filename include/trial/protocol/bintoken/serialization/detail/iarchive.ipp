@@ -93,6 +93,11 @@ inline auto iarchive::length() const -> size_type
     return reader.length();
 }
 
+inline auto iarchive::tail() const -> const view_type&
+{
+    return reader.tail();
+}
+
 inline void iarchive::next()
 {
     if (!reader.next() && (reader.symbol() == token::symbol::error))
@@ -11,6 +11,7 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
 #include <cassert>
 #include <trial/protocol/bintoken/serialization/serialization.hpp>
 #include <trial/protocol/serialization/dynamic/variable.hpp>
@@ -115,11 +116,14 @@ struct save_overloader< protocol::bintoken::oarchive,
 
         case dynamic::code::map:
             ar.template save<bintoken::token::begin_assoc_array>();
-            ar.template save<bintoken::token::null>();
+            ar.template save<std::size_t>(data.size());
             for (auto it = data.begin(); it != data.end(); ++it)
             {
-                auto value = std::make_pair(it.key(), it.value());;
-                ar.save_override(value, protocol_version);
+                // Written as a record without copying the key and value
+                ar.template save<bintoken::token::begin_record>();
+                ar.save_override(it.key(), protocol_version);
+                ar.save_override(it.value(), protocol_version);
+                ar.template save<bintoken::token::end_record>();
             }
             ar.template save<bintoken::token::end_assoc_array>();
             break;
@@ -183,11 +187,18 @@ struct load_overloader< protocol::bintoken::iarchive,
                 ar.load_override(count);
 
                 data = dynamic::array::make();
+                auto& items = data.assume_value<dynamic::variable::array_type>();
+                if (count)
+                {
+                    // The count is untrusted, but each element occupies at
+                    // least one byte of the remaining input
+                    items.reserve(std::min(*count, ar.tail().size()));
+                }
                 while (!ar.template at<token::end_array>())
                 {
                     dynamic::variable value;
                     ar.load_override(value);
-                    data.insert(data.end(), value);
+                    items.push_back(std::move(value));
                 }
                 ar.template load<token::end_array>();
             }
@@ -201,11 +212,12 @@ struct load_overloader< protocol::bintoken::iarchive,
                 ar.load_override(count);
 
                 data = dynamic::map::make();
+                auto& members = data.assume_value<dynamic::variable::map_type>();
                 while (!ar.template at<token::end_assoc_array>())
                 {
                     std::pair<std::string, dynamic::variable> value;
                     ar.load_override(value);
-                    data.insert(data.end(), { std::move(value.first), std::move(value.second) });
+                    members.emplace(std::move(value.first), std::move(value.second));
                 }
                 ar.template load<token::end_assoc_array>();
             }
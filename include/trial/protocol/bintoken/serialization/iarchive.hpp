@@ -60,6 +60,7 @@ public:
     token::symbol::value symbol() const;
     token::category::value category() const;
     size_type length() const;
+    const view_type& tail() const;
 
     // Ignore these
     void load(boost::archive::version_type&) {}
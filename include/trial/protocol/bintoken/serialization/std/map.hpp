@@ -32,7 +32,7 @@ struct save_overloader< protocol::bintoken::oarchive,
                      const unsigned int protocol_version)
     {
         ar.save<bintoken::token::begin_assoc_array>();
-        ar.save<bintoken::token::null>();
+        ar.save<std::size_t>(data.size());
         for (typename std::map<Key, T, Compare, Allocator>::const_iterator it = data.begin();
              it != data.end();
              ++it)
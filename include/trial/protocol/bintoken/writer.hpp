@@ -22,13 +22,17 @@ namespace protocol
 namespace bintoken
 {
 
-template <std::size_t N = 2 * sizeof(void *)>
+//! @brief Incremental bintoken writer.
+//!
+//! The output buffer is type-erased unless OutputType is given.
+template <std::size_t N = 2 * sizeof(void *),
+          typename OutputType = void>
 class basic_writer
 {
 public:
-    using size_type = typename detail::basic_encoder<N>::size_type;
-    using view_type = typename detail::basic_encoder<N>::view_type;
-    using string_view_type = typename detail::basic_encoder<N>::string_view_type;
+    using size_type = typename detail::basic_encoder<N, OutputType>::size_type;
+    using view_type = typename detail::basic_encoder<N, OutputType>::view_type;
+    using string_view_type = typename detail::basic_encoder<N, OutputType>::string_view_type;
 
     template <typename T> basic_writer(T&);
 
@@ -47,7 +51,7 @@ private:
 private:
     template <typename T, typename Enable = void> struct overloader;
 
-    detail::basic_encoder<N> encoder;
+    detail::basic_encoder<N, OutputType> encoder;
     std::stack<token::code::value> stack;
 };
 
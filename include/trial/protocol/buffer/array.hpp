@@ -57,20 +57,19 @@ public:
         return size_type(current - begin());
     }
 
-private:
-    virtual bool grow(size_type delta)
+    bool grow(size_type delta)
     {
         return (N - size() >= delta);
     }
 
-    virtual void write(value_type value)
+    void write(value_type value)
     {
         assert(grow(sizeof(value_type)));
         *current = value;
         ++current;
     }
 
-    virtual void write(const view_type& view)
+    void write(const view_type& view)
     {
         assert(grow(view.size()));
         current = std::copy(view.begin(), view.end(), current);
@@ -86,6 +85,7 @@ struct traits< std::array<CharT, N> >
 {
     using view_type = typename base<CharT>::view_type;
     using buffer_type = buffer::array<CharT, N>;
+    using static_buffer_type = buffer::array<CharT, N, static_base<CharT>>;
 
     static view_type view_cast(const std::array<CharT, N>& data)
     {
@@ -98,6 +98,7 @@ struct traits<CharT[N]>
 {
     using view_type = typename base<CharT>::view_type;
     using buffer_type = buffer::array<CharT, N>;
+    using static_buffer_type = buffer::array<CharT, N, static_base<CharT>>;
 
     static view_type view_cast(const CharT(&data)[N])
     {
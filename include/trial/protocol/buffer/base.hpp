@@ -37,6 +37,20 @@ public:
     virtual void write(const view_type&) = 0;
 };
 
+//! @brief Non-polymorphic buffer interface.
+//!
+//! Buffers that use static_base as their Super type have no virtual
+//! functions. Encoders that know the buffer type at compile-time call such
+//! buffers directly, so each write can be inlined.
+template <typename CharT>
+class static_base
+{
+public:
+    using value_type = CharT;
+    using size_type = std::size_t;
+    using view_type = core::detail::basic_string_view<value_type, core::char_traits<value_type>>;
+};
+
 template <typename T, typename Enable = void>
 struct traits
 {
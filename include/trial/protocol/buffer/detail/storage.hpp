@@ -0,0 +1,105 @@
+#ifndef TRIAL_PROTOCOL_BUFFER_DETAIL_STORAGE_HPP
+#define TRIAL_PROTOCOL_BUFFER_DETAIL_STORAGE_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef> // std::size_t
+#include <memory> // std::addressof
+#include <new>
+#include <type_traits>
+#include <boost/config.hpp>
+#include <trial/protocol/buffer/base.hpp>
+
+namespace trial
+{
+namespace protocol
+{
+namespace buffer
+{
+namespace detail
+{
+
+// Buffer owned by an encoder.
+//
+// The buffer type is selected from the output type at compile-time, so the
+// encoder calls the buffer without virtual dispatch.
+template <typename CharT, std::size_t N, typename OutputType>
+class storage
+{
+public:
+    using buffer_type = typename traits<OutputType>::static_buffer_type;
+
+    static_assert(std::is_same<typename buffer_type::value_type, CharT>::value,
+                  "OutputType must contain CharT");
+
+    storage(OutputType& output)
+        : content(output)
+    {
+    }
+
+    buffer_type& get() BOOST_NOEXCEPT
+    {
+        return content;
+    }
+
+    const buffer_type& get() const BOOST_NOEXCEPT
+    {
+        return content;
+    }
+
+private:
+    buffer_type content;
+};
+
+// Type-erased buffer owned by an encoder.
+//
+// Any buffer that fits into N bytes is constructed in-place and called via
+// the virtual buffer::base interface.
+template <typename CharT, std::size_t N>
+class storage<CharT, N, void>
+{
+public:
+    using buffer_type = buffer::base<CharT>;
+
+    template <typename T>
+    storage(T& output)
+    {
+        static_assert(N >= sizeof(typename traits<T>::buffer_type),
+                      "N is smaller than buffer_type");
+
+        ::new (std::addressof(content)) typename traits<T>::buffer_type(output);
+    }
+
+    ~storage()
+    {
+        get().~buffer_type();
+    }
+
+    buffer_type& get() BOOST_NOEXCEPT
+    {
+        return reinterpret_cast<buffer_type&>(content);
+    }
+
+    const buffer_type& get() const BOOST_NOEXCEPT
+    {
+        return reinterpret_cast<const buffer_type&>(content);
+    }
+
+private:
+    typename std::aligned_storage<N>::type content;
+};
+
+} // namespace detail
+} // namespace buffer
+} // namespace protocol
+} // namespace trial
+
+#endif // TRIAL_PROTOCOL_BUFFER_DETAIL_STORAGE_HPP
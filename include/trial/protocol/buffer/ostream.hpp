@@ -33,18 +33,17 @@ public:
 
     basic_ostream(std::basic_ostream<CharT, Traits>& stream) : content(stream) {}
 
-protected:
-    virtual bool grow(size_type)
+    bool grow(size_type)
     {
         return content.good();
     }
 
-    virtual void write(value_type value)
+    void write(value_type value)
     {
         content << value;
     }
 
-    virtual void write(const view_type& view)
+    void write(const view_type& view)
     {
         content << view;
     }
@@ -62,6 +61,7 @@ struct traits<T<CharT, Traits>,
                                                        T<CharT, Traits> >::value >::type>
 {
     using buffer_type = buffer::basic_ostream<CharT, Traits>;
+    using static_buffer_type = buffer::basic_ostream<CharT, Traits, static_base<CharT>>;
 };
 
 // Specialization for C++11 basic_ostringstream with allocator
@@ -74,6 +74,7 @@ struct traits<T<CharT, Traits, Allocator>,
                                                        T<CharT, Traits, Allocator> >::value >::type>
 {
     using buffer_type = buffer::basic_ostream<CharT, Traits>;
+    using static_buffer_type = buffer::basic_ostream<CharT, Traits, static_base<CharT>>;
 };
 
 } // namespace buffer
@@ -35,8 +35,7 @@ public:
     {
     }
 
-protected:
-    virtual bool grow(size_type delta)
+    bool grow(size_type delta)
     {
         const size_type size = content.size() + delta + 1;
         if (size > content.capacity())
@@ -48,12 +47,12 @@ protected:
         return true;
     }
 
-    virtual void write(value_type value)
+    void write(value_type value)
     {
         content.push_back(value);
     }
 
-    virtual void write(const view_type& view)
+    void write(const view_type& view)
     {
         content.append(view.begin(), view.size());
     }
@@ -66,6 +65,7 @@ template <typename CharT>
 struct traits< std::basic_string<CharT> >
 {
     using buffer_type = buffer::basic_string<CharT>;
+    using static_buffer_type = buffer::basic_string<CharT, static_base<CharT>>;
 };
 
 } // namespace buffer
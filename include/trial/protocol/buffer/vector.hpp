@@ -22,21 +22,21 @@ namespace buffer
 {
 
 template <typename CharT,
-          typename Allocator = typename std::vector<CharT>::allocator_type>
-class vector : public base<CharT>
+          typename Allocator = typename std::vector<CharT>::allocator_type,
+          typename Super = base<CharT> >
+class vector : public Super
 {
 public:
-    using value_type = typename base<CharT>::value_type;
-    using size_type = typename base<CharT>::size_type;
-    using view_type = typename base<CharT>::view_type;
+    using value_type = typename Super::value_type;
+    using size_type = typename Super::size_type;
+    using view_type = typename Super::view_type;
 
-    vector(std::vector<value_type>& data)
+    vector(std::vector<value_type, Allocator>& data)
         : buffer(data)
     {
     }
 
-protected:
-    virtual bool grow(size_type delta)
+    bool grow(size_type delta)
     {
         const size_type size = buffer.size() + delta;
         if (size > buffer.capacity())
@@ -48,12 +48,12 @@ protected:
         return true;
     }
 
-    virtual void write(value_type value)
+    void write(value_type value)
     {
         buffer.push_back(value);
     }
 
-    virtual void write(const view_type& view)
+    void write(const view_type& view)
     {
         if (grow(view.size()))
         {
@@ -70,6 +70,7 @@ struct traits< std::vector<CharT, Allocator> >
 {
     using view_type = typename base<CharT>::view_type;
     using buffer_type = buffer::vector<CharT, Allocator>;
+    using static_buffer_type = buffer::vector<CharT, Allocator, static_base<CharT>>;
 
     static view_type view_cast(const std::vector<CharT>& data)
     {
@@ -0,0 +1,205 @@
+#ifndef TRIAL_PROTOCOL_CORE_ARENA_HPP
+#define TRIAL_PROTOCOL_CORE_ARENA_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef> // std::size_t
+#include <memory>
+#include <type_traits>
+#include <boost/config.hpp>
+
+namespace trial
+{
+namespace protocol
+{
+namespace core
+{
+
+//! @brief Monotonic memory arena.
+//!
+//! Memory is handed out by bumping a pointer within large blocks. Individual
+//! allocations are never returned to the arena. Instead all memory is released
+//! at once when the arena is released or destroyed.
+class arena
+{
+public:
+    using size_type = std::size_t;
+
+    //! @param[in] block_size Size of the blocks requested from the heap.
+    explicit arena(size_type block_size = 64 * 1024);
+
+    arena(const arena&) = delete;
+    arena& operator=(const arena&) = delete;
+
+    ~arena();
+
+    //! @brief Allocate memory.
+    //!
+    //! @param[in] size Number of bytes.
+    //! @param[in] alignment Alignment, which must be a power of two no larger
+    //!            than alignof(std::max_align_t).
+    //! @throws std::bad_alloc If no memory is available.
+    void *allocate(size_type size, size_type alignment);
+
+    //! @brief Release all memory.
+    //!
+    //! Objects allocated from the arena must not be used afterwards.
+    void release() BOOST_NOEXCEPT;
+
+    //! @brief Release all memory except the current block.
+    //!
+    //! The current block is reused for subsequent allocations, so an arena
+    //! can be recycled between similar workloads without heap allocations.
+    //!
+    //! Objects allocated from the arena must not be used afterwards.
+    void reset() BOOST_NOEXCEPT;
+
+    //! @returns Number of bytes allocated from the heap.
+    size_type capacity() const BOOST_NOEXCEPT;
+
+    //! @brief Make arena the default for arena_allocator in the current thread.
+    //!
+    //! Containers default-construct their allocators, so this is how an arena
+    //! is passed to the allocators of nested containers. The previous arena is
+    //! restored when the scope ends.
+    class scope
+    {
+    public:
+        explicit scope(arena&) BOOST_NOEXCEPT;
+        scope(const scope&) = delete;
+        scope& operator=(const scope&) = delete;
+        ~scope();
+
+    private:
+        arena *previous;
+    };
+
+    //! @returns The arena of the innermost scope in the current thread, or
+    //!          nullptr if there is none.
+    static arena *current() BOOST_NOEXCEPT;
+
+#ifndef BOOST_DOXYGEN_INVOKED
+private:
+    struct block
+    {
+        block *next;
+        size_type size;
+    };
+
+    void *allocate_block(size_type size, size_type alignment);
+    static arena *& current_reference() BOOST_NOEXCEPT;
+
+private:
+    size_type block_size;
+    block *blocks;
+    char *head;
+    char *tail;
+    size_type total;
+#endif
+};
+
+//! @brief Allocator that obtains memory from an arena.
+//!
+//! A default-constructed allocator uses arena::current(). Without a current
+//! arena it falls back to the heap, so variables created outside a scope
+//! behave as with std::allocator.
+//!
+//! Deallocation from an arena does nothing. The arena must outlive all
+//! containers that use it.
+//!
+//! The allocator is not propagated on container assignment or swap, and a
+//! copied container uses the default allocator, so a copy of an arena-backed
+//! container made outside the scope of the arena does not refer to the arena.
+//!
+//! The allocator can be used as the Allocator template argument of
+//! dynamic::basic_variable.
+template <typename T>
+class arena_allocator
+{
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::false_type;
+    using propagate_on_container_swap = std::false_type;
+
+    template <typename U>
+    struct rebind
+    {
+        using other = arena_allocator<U>;
+    };
+
+    arena_allocator() BOOST_NOEXCEPT
+        : memory(arena::current())
+    {
+    }
+
+    explicit arena_allocator(arena& memory) BOOST_NOEXCEPT
+        : memory(&memory)
+    {
+    }
+
+    template <typename U>
+    arena_allocator(const arena_allocator<U>& other) BOOST_NOEXCEPT
+        : memory(other.resource())
+    {
+    }
+
+    T *allocate(size_type n)
+    {
+        if (memory)
+            return static_cast<T *>(memory->allocate(n * sizeof(T), alignof(T)));
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T *pointer, size_type n) BOOST_NOEXCEPT
+    {
+        if (!memory)
+            std::allocator<T>().deallocate(pointer, n);
+    }
+
+    //! @returns Allocator for the arena of the current thread.
+    arena_allocator select_on_container_copy_construction() const BOOST_NOEXCEPT
+    {
+        return arena_allocator();
+    }
+
+    //! @returns The arena, or nullptr if the heap is used.
+    arena *resource() const BOOST_NOEXCEPT
+    {
+        return memory;
+    }
+
+#ifndef BOOST_DOXYGEN_INVOKED
+private:
+    arena *memory;
+#endif
+};
+
+template <typename T, typename U>
+bool operator==(const arena_allocator<T>& lhs, const arena_allocator<U>& rhs) BOOST_NOEXCEPT
+{
+    return lhs.resource() == rhs.resource();
+}
+
+template <typename T, typename U>
+bool operator!=(const arena_allocator<T>& lhs, const arena_allocator<U>& rhs) BOOST_NOEXCEPT
+{
+    return !(lhs == rhs);
+}
+
+} // namespace core
+} // namespace protocol
+} // namespace trial
+
+#include <trial/protocol/core/detail/arena.ipp>
+
+#endif // TRIAL_PROTOCOL_CORE_ARENA_HPP
@@ -0,0 +1,156 @@
+#ifndef TRIAL_PROTOCOL_CORE_DETAIL_ARENA_IPP
+#define TRIAL_PROTOCOL_CORE_DETAIL_ARENA_IPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <cstdint>
+#include <new>
+
+namespace trial
+{
+namespace protocol
+{
+namespace core
+{
+
+inline arena::arena(size_type block_size)
+    : block_size(block_size),
+      blocks(nullptr),
+      head(nullptr),
+      tail(nullptr),
+      total(0)
+{
+}
+
+inline arena::~arena()
+{
+    release();
+}
+
+inline void *arena::allocate(size_type size, size_type alignment)
+{
+    assert((alignment & (alignment - 1)) == 0);
+    assert(alignment <= alignof(std::max_align_t));
+
+    if (head)
+    {
+        const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(head);
+        const std::uintptr_t aligned = (address + alignment - 1) & ~std::uintptr_t(alignment - 1);
+        char *result = head + (aligned - address);
+        if (size <= size_type(tail - result))
+        {
+            head = result + size;
+            return result;
+        }
+    }
+    return allocate_block(size, alignment);
+}
+
+inline void *arena::allocate_block(size_type size, size_type alignment)
+{
+    // The header is padded so that the payload is maximally aligned
+    const size_type header = (sizeof(block) + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+    if (size > block_size / 4)
+    {
+        // Large allocations get a block of their own so the current block
+        // can still be used for subsequent small allocations
+        auto large = static_cast<block *>(::operator new(header + size));
+        total += header + size;
+        if (blocks)
+        {
+            large->next = blocks->next;
+            blocks->next = large;
+        }
+        else
+        {
+            large->next = nullptr;
+            blocks = large;
+        }
+        large->size = header + size;
+        return reinterpret_cast<char *>(large) + header;
+    }
+
+    auto fresh = static_cast<block *>(::operator new(header + block_size));
+    fresh->next = blocks;
+    fresh->size = header + block_size;
+    blocks = fresh;
+    total += fresh->size;
+    head = reinterpret_cast<char *>(fresh) + header;
+    tail = head + block_size;
+    return allocate(size, alignment);
+}
+
+inline void arena::release() BOOST_NOEXCEPT
+{
+    while (blocks)
+    {
+        block *next = blocks->next;
+        ::operator delete(blocks);
+        blocks = next;
+    }
+    head = nullptr;
+    tail = nullptr;
+    total = 0;
+}
+
+inline void arena::reset() BOOST_NOEXCEPT
+{
+    if (!head)
+    {
+        release();
+        return;
+    }
+    // Large blocks are linked after the current block, which is therefore
+    // at the front whenever there is a current block
+    block *current = blocks;
+    while (current->next)
+    {
+        block *next = current->next->next;
+        ::operator delete(current->next);
+        current->next = next;
+    }
+    head = tail - block_size;
+    total = current->size;
+}
+
+inline auto arena::capacity() const BOOST_NOEXCEPT -> size_type
+{
+    return total;
+}
+
+inline arena *& arena::current_reference() BOOST_NOEXCEPT
+{
+    static thread_local arena *instance = nullptr;
+    return instance;
+}
+
+inline arena *arena::current() BOOST_NOEXCEPT
+{
+    return current_reference();
+}
+
+inline arena::scope::scope(arena& memory) BOOST_NOEXCEPT
+    : previous(current_reference())
+{
+    current_reference() = &memory;
+}
+
+inline arena::scope::~scope()
+{
+    current_reference() = previous;
+}
+
+} // namespace core
+} // namespace protocol
+} // namespace trial
+
+#endif // TRIAL_PROTOCOL_CORE_DETAIL_ARENA_IPP
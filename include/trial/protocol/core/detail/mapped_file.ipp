@@ -0,0 +1,202 @@
+#ifndef TRIAL_PROTOCOL_CORE_DETAIL_MAPPED_FILE_IPP
+#define TRIAL_PROTOCOL_CORE_DETAIL_MAPPED_FILE_IPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <system_error>
+#include <type_traits>
+
+#if defined(_WIN32)
+# if !defined(WIN32_LEAN_AND_MEAN)
+#  define WIN32_LEAN_AND_MEAN
+# endif
+# if !defined(NOMINMAX)
+#  define NOMINMAX
+# endif
+# include <windows.h>
+#else
+# include <cerrno>
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+namespace trial
+{
+namespace protocol
+{
+namespace core
+{
+
+inline mapped_file::mapped_file(const char *path)
+    : address(nullptr),
+      length(0)
+{
+    open(path);
+}
+
+inline mapped_file::mapped_file(const std::string& path)
+    : address(nullptr),
+      length(0)
+{
+    open(path.c_str());
+}
+
+inline mapped_file::mapped_file(mapped_file&& other) BOOST_NOEXCEPT
+    : address(other.address),
+      length(other.length)
+{
+    other.address = nullptr;
+    other.length = 0;
+}
+
+inline mapped_file& mapped_file::operator=(mapped_file&& other) BOOST_NOEXCEPT
+{
+    if (this != &other)
+    {
+        close();
+        address = other.address;
+        length = other.length;
+        other.address = nullptr;
+        other.length = 0;
+    }
+    return *this;
+}
+
+inline mapped_file::~mapped_file()
+{
+    close();
+}
+
+inline const void *mapped_file::data() const BOOST_NOEXCEPT
+{
+    return address;
+}
+
+inline auto mapped_file::size() const BOOST_NOEXCEPT -> size_type
+{
+    return length;
+}
+
+template <typename CharT>
+auto mapped_file::view() const BOOST_NOEXCEPT -> core::detail::basic_string_view<CharT, core::char_traits<CharT>>
+{
+    static_assert(sizeof(CharT) == 1, "CharT must be a byte type");
+
+    return { static_cast<const CharT *>(address), length };
+}
+
+#if defined(_WIN32)
+
+inline void mapped_file::open(const char *path)
+{
+    HANDLE file = ::CreateFileA(path,
+                                GENERIC_READ,
+                                FILE_SHARE_READ,
+                                nullptr,
+                                OPEN_EXISTING,
+                                FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+                                nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        throw std::system_error(int(::GetLastError()), std::system_category());
+
+    LARGE_INTEGER file_size;
+    if (!::GetFileSizeEx(file, &file_size))
+    {
+        const DWORD error = ::GetLastError();
+        ::CloseHandle(file);
+        throw std::system_error(int(error), std::system_category());
+    }
+    if (file_size.QuadPart == 0)
+    {
+        // Empty files cannot be mapped
+        ::CloseHandle(file);
+        return;
+    }
+
+    HANDLE mapping = ::CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    const DWORD mapping_error = ::GetLastError();
+    ::CloseHandle(file);
+    if (mapping == nullptr)
+        throw std::system_error(int(mapping_error), std::system_category());
+
+    address = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    const DWORD view_error = ::GetLastError();
+    ::CloseHandle(mapping);
+    if (address == nullptr)
+        throw std::system_error(int(view_error), std::system_category());
+    length = size_type(file_size.QuadPart);
+}
+
+inline void mapped_file::close() BOOST_NOEXCEPT
+{
+    if (address)
+    {
+        ::UnmapViewOfFile(address);
+        address = nullptr;
+        length = 0;
+    }
+}
+
+#else
+
+inline void mapped_file::open(const char *path)
+{
+    const int fd = ::open(path, O_RDONLY);
+    if (fd == -1)
+        throw std::system_error(errno, std::generic_category());
+
+    struct stat status;
+    if (::fstat(fd, &status) == -1)
+    {
+        const int error = errno;
+        ::close(fd);
+        throw std::system_error(error, std::generic_category());
+    }
+    if (status.st_size == 0)
+    {
+        // Empty files cannot be mapped
+        ::close(fd);
+        return;
+    }
+
+    void *result = ::mmap(nullptr, size_type(status.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    const int error = errno;
+    // The mapping remains valid after the file is closed
+    ::close(fd);
+    if (result == MAP_FAILED)
+        throw std::system_error(error, std::generic_category());
+
+    address = result;
+    length = size_type(status.st_size);
+#if defined(POSIX_MADV_SEQUENTIAL)
+    ::posix_madvise(address, length, POSIX_MADV_SEQUENTIAL);
+#endif
+}
+
+inline void mapped_file::close() BOOST_NOEXCEPT
+{
+    if (address)
+    {
+        ::munmap(address, length);
+        address = nullptr;
+        length = 0;
+    }
+}
+
+#endif
+
+} // namespace core
+} // namespace protocol
+} // namespace trial
+
+#endif // TRIAL_PROTOCOL_CORE_DETAIL_MAPPED_FILE_IPP
@@ -0,0 +1,99 @@
+#ifndef TRIAL_PROTOCOL_CORE_DETAIL_PARALLEL_HPP
+#define TRIAL_PROTOCOL_CORE_DETAIL_PARALLEL_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef> // std::size_t
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace trial
+{
+namespace protocol
+{
+namespace core
+{
+namespace detail
+{
+
+//! @brief Number of tasks to use when the caller does not specify any.
+inline std::size_t default_concurrency()
+{
+    const std::size_t result = std::thread::hardware_concurrency();
+    return (result == 0) ? 1 : result;
+}
+
+//! @brief Invoke function(task) for each task in [0, tasks) concurrently.
+//!
+//! Task 0 is executed by the calling thread and each of the remaining tasks
+//! by its own thread. Returns when all tasks have completed. If any task
+//! throws, the exception of the lowest-numbered failing task is rethrown.
+template <typename Function>
+void parallel_invoke(std::size_t tasks, Function function)
+{
+    if (tasks == 0)
+        return;
+
+    std::vector<std::exception_ptr> failures(tasks);
+    std::vector<std::thread> threads;
+    threads.reserve(tasks - 1);
+    try
+    {
+        for (std::size_t task = 1; task < tasks; ++task)
+        {
+            threads.emplace_back([&function, &failures, task]
+                                 {
+                                     try
+                                     {
+                                         function(task);
+                                     }
+                                     catch (...)
+                                     {
+                                         failures[task] = std::current_exception();
+                                     }
+                                 });
+        }
+    }
+    catch (...)
+    {
+        // Running threads must be joined before they are destroyed
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        throw;
+    }
+    try
+    {
+        function(std::size_t(0));
+    }
+    catch (...)
+    {
+        failures[0] = std::current_exception();
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    for (const auto& failure : failures)
+    {
+        if (failure)
+            std::rethrow_exception(failure);
+    }
+}
+
+} // namespace detail
+} // namespace core
+} // namespace protocol
+} // namespace trial
+
+#endif // TRIAL_PROTOCOL_CORE_DETAIL_PARALLEL_HPP
@@ -0,0 +1,118 @@
+#ifndef TRIAL_PROTOCOL_CORE_DETAIL_SIMD_HPP
+#define TRIAL_PROTOCOL_CORE_DETAIL_SIMD_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <boost/config.hpp>
+
+// Vectorized code paths can be disabled by defining TRIAL_PROTOCOL_NO_SIMD
+
+#if !defined(TRIAL_PROTOCOL_NO_SIMD)
+# if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#  define TRIAL_PROTOCOL_SIMD_SSE2 1
+#  include <emmintrin.h>
+# endif
+# if defined(TRIAL_PROTOCOL_SIMD_SSE2) && (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#  define TRIAL_PROTOCOL_SIMD_AVX2 1
+#  define TRIAL_PROTOCOL_SIMD_TARGET_AVX2 __attribute__((target("avx2")))
+#  include <immintrin.h>
+# endif
+#endif
+
+#if defined(_MSC_VER)
+# include <intrin.h>
+#endif
+
+namespace trial
+{
+namespace protocol
+{
+namespace core
+{
+namespace detail
+{
+namespace simd
+{
+
+//! @brief Instruction sets that vectorized kernels are available for.
+enum class instruction_set
+{
+    scalar,
+    sse2,
+    avx2
+};
+
+//! @returns The best instruction set supported by the running processor.
+inline instruction_set detect() BOOST_NOEXCEPT
+{
+#if defined(TRIAL_PROTOCOL_SIMD_AVX2)
+    if (__builtin_cpu_supports("avx2"))
+        return instruction_set::avx2;
+#endif
+#if defined(TRIAL_PROTOCOL_SIMD_SSE2)
+    return instruction_set::sse2;
+#else
+    return instruction_set::scalar;
+#endif
+}
+
+//! @brief Instruction set used by the vectorized kernels.
+//!
+//! Initialized at first use with the result of detect(). The selection can be
+//! lowered (but must never be raised beyond detect()) to compare code paths in
+//! tests and benchmarks. Changing the selection is not thread-safe.
+inline instruction_set& selected() BOOST_NOEXCEPT
+{
+    static instruction_set value = detect();
+    return value;
+}
+
+//! @returns Index of the least significant set bit. Mask must be non-zero.
+inline unsigned int count_trailing_zeros(std::uint32_t mask) BOOST_NOEXCEPT
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return unsigned(__builtin_ctz(mask));
+#elif defined(_MSC_VER)
+    unsigned long result;
+    _BitScanForward(&result, mask);
+    return unsigned(result);
+#else
+    unsigned int result = 0;
+    while ((mask & 1) == 0)
+    {
+        mask >>= 1;
+        ++result;
+    }
+    return result;
+#endif
+}
+
+//! @returns Number of set bits.
+inline unsigned int count_ones(std::uint64_t mask) BOOST_NOEXCEPT
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return unsigned(__builtin_popcountll(mask));
+#else
+    mask = mask - ((mask >> 1) & 0x5555555555555555ULL);
+    mask = (mask & 0x3333333333333333ULL) + ((mask >> 2) & 0x3333333333333333ULL);
+    mask = (mask + (mask >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return unsigned((mask * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+} // namespace simd
+} // namespace detail
+} // namespace core
+} // namespace protocol
+} // namespace trial
+
+#endif // TRIAL_PROTOCOL_CORE_DETAIL_SIMD_HPP
@@ -0,0 +1,119 @@
+#ifndef TRIAL_PROTOCOL_CORE_DETAIL_SMALL_STACK_HPP
+#define TRIAL_PROTOCOL_CORE_DETAIL_SMALL_STACK_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <cstddef> // std::size_t
+#include <algorithm>
+#include <array>
+#include <vector>
+#include <boost/config.hpp>
+
+namespace trial
+{
+namespace protocol
+{
+namespace core
+{
+namespace detail
+{
+
+//! @brief Stack with inline storage for the first N elements.
+//!
+//! Elements beyond the inline capacity are stored on the heap. T must be
+//! default constructible and copy assignable.
+template <typename T, std::size_t N>
+class small_stack
+{
+    static_assert(N > 0, "N must be positive");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+    small_stack() BOOST_NOEXCEPT
+        : count(0)
+    {
+    }
+
+    small_stack(const small_stack& other)
+        : overflow(other.overflow),
+          count(other.count)
+    {
+        // Only copy elements in use
+        std::copy(other.storage.begin(), other.storage.begin() + std::min(count, N), storage.begin());
+    }
+
+    small_stack& operator=(const small_stack& other)
+    {
+        std::copy(other.storage.begin(), other.storage.begin() + std::min(other.count, N), storage.begin());
+        overflow = other.overflow;
+        count = other.count;
+        return *this;
+    }
+
+    bool empty() const BOOST_NOEXCEPT
+    {
+        return count == 0;
+    }
+
+    size_type size() const BOOST_NOEXCEPT
+    {
+        return count;
+    }
+
+    static BOOST_CONSTEXPR size_type inline_capacity() BOOST_NOEXCEPT
+    {
+        return N;
+    }
+
+    value_type& top() BOOST_NOEXCEPT
+    {
+        assert(count > 0);
+        return (count <= N) ? storage[count - 1] : overflow.back();
+    }
+
+    const value_type& top() const BOOST_NOEXCEPT
+    {
+        assert(count > 0);
+        return (count <= N) ? storage[count - 1] : overflow.back();
+    }
+
+    void push(const value_type& value)
+    {
+        if (count < N)
+            storage[count] = value;
+        else
+            overflow.push_back(value);
+        ++count;
+    }
+
+    void pop() BOOST_NOEXCEPT
+    {
+        assert(count > 0);
+        if (count > N)
+            overflow.pop_back();
+        --count;
+    }
+
+private:
+    std::array<value_type, N> storage;
+    std::vector<value_type> overflow;
+    size_type count;
+};
+
+} // namespace detail
+} // namespace core
+} // namespace protocol
+} // namespace trial
+
+#endif // TRIAL_PROTOCOL_CORE_DETAIL_SMALL_STACK_HPP
@@ -0,0 +1,86 @@
+#ifndef TRIAL_PROTOCOL_CORE_MAPPED_FILE_HPP
+#define TRIAL_PROTOCOL_CORE_MAPPED_FILE_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef> // std::size_t
+#include <string>
+#include <boost/config.hpp>
+#include <trial/protocol/core/detail/string_view.hpp>
+#include <trial/protocol/core/char_traits.hpp>
+
+namespace trial
+{
+namespace protocol
+{
+namespace core
+{
+
+//! @brief Read-only memory-mapped file.
+//!
+//! Maps the entire content of a file into memory, so it can be parsed directly
+//! without copying it into a string first. The mapping is released when the
+//! object is destroyed.
+//!
+//! The operating system is advised that the content will be accessed
+//! sequentially.
+class mapped_file
+{
+public:
+    using size_type = std::size_t;
+
+    //! @brief Map file into memory.
+    //!
+    //! @param[in] path Name of the file.
+    //! @throws std::system_error If the file cannot be opened or mapped.
+    explicit mapped_file(const char *path);
+    explicit mapped_file(const std::string& path);
+
+    mapped_file(mapped_file&&) BOOST_NOEXCEPT;
+    mapped_file& operator=(mapped_file&&) BOOST_NOEXCEPT;
+    mapped_file(const mapped_file&) = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+
+    ~mapped_file();
+
+    //! @returns Pointer to the mapped content, or nullptr if the file is empty.
+    const void *data() const BOOST_NOEXCEPT;
+
+    //! @returns Size of the mapped content in bytes.
+    size_type size() const BOOST_NOEXCEPT;
+
+    //! @brief Get a view of the mapped content.
+    //!
+    //! The view can be passed to readers and parsers, such as json::reader
+    //! with CharT = char, or bintoken::reader with CharT = std::uint8_t.
+    //!
+    //! The view is valid until the mapped_file is destroyed.
+    template <typename CharT = char>
+    core::detail::basic_string_view<CharT, core::char_traits<CharT>> view() const BOOST_NOEXCEPT;
+
+#ifndef BOOST_DOXYGEN_INVOKED
+private:
+    void open(const char *path);
+    void close() BOOST_NOEXCEPT;
+
+private:
+    void *address;
+    size_type length;
+#endif
+};
+
+} // namespace core
+} // namespace protocol
+} // namespace trial
+
+#include <trial/protocol/core/detail/mapped_file.ipp>
+
+#endif // TRIAL_PROTOCOL_CORE_MAPPED_FILE_HPP
@@ -37,7 +37,13 @@ public:
     using value_type = CharT;
     using view_type = core::detail::basic_string_view<CharT, core::char_traits<CharT>>;
 
-    basic_decoder(const view_type& input);
+    // If mutable_input is true, then the input buffer must be writable, and
+    // escaped strings are unescaped within it.
+    basic_decoder(const view_type& input, bool mutable_input = false);
+
+    // Construct with a token that has already been scanned from literal, so
+    // its value can be converted without scanning the input again.
+    basic_decoder(token::detail::code::value code, const view_type& literal, bool escaped) BOOST_NOEXCEPT;
 
     void next() BOOST_NOEXCEPT;
 
@@ -46,7 +52,17 @@ public:
     std::error_code error() const BOOST_NOEXCEPT;
     const view_type& literal() const BOOST_NOEXCEPT;
     const view_type& tail() const BOOST_NOEXCEPT;
+    bool escaped() const BOOST_NOEXCEPT;
     template <typename ReturnType> ReturnType value() const;
+    view_type string_view(std::basic_string<CharT>& scratch) const;
+
+    // Move views into a relocated input buffer. The offsets are the positions
+    // of the current token and the remaining input within the new buffer.
+    void relocate(const view_type& buffer, size_type literal_offset, size_type input_offset) BOOST_NOEXCEPT;
+
+    // Discard the input before position, which must be within the remaining
+    // input, and parse the token at position.
+    void seek(const value_type *position) BOOST_NOEXCEPT;
 
 private:
     token::detail::code::value next_token(token::detail::code::value) BOOST_NOEXCEPT;
@@ -65,13 +81,26 @@ private:
     template <typename ReturnType> ReturnType unsigned_integer_value() const;
     template <typename ReturnType> ReturnType real_value() const;
     std::basic_string<CharT> string_value() const;
+    view_type unquoted_literal() const BOOST_NOEXCEPT;
+    template <typename Output> void unescape(Output& result) const;
+    view_type unescape_in_situ() const BOOST_NOEXCEPT;
 
 private:
     view_type input;
+    bool mutable_input;
     struct
     {
         mutable token::detail::code::value code;
         view_type view;
+        // String token contains escaped characters
+        bool escaped;
+        // String content once unescaped in situ. The view of the token is
+        // left unchanged, but its characters have been overwritten.
+        mutable view_type unescaped;
+        // Magnitude of integer token converted during scanning
+        std::uint64_t magnitude;
+        // Magnitude does not fit into 64 bits
+        bool overflow;
     } current;
 };
 
@@ -11,13 +11,14 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
 #include <cassert>
-#include <cstdlib> // std::atof
 #include <iterator>
 #include <limits>
 #include <type_traits>
 #include <trial/protocol/json/detail/string_converter.hpp>
 #include <trial/protocol/json/detail/decoder.hpp>
+#include <trial/protocol/json/detail/scan.hpp>
 #include <trial/protocol/json/detail/traits.hpp>
 #include <trial/protocol/json/error.hpp>
 
@@ -121,13 +122,43 @@ struct basic_decoder<CharT>::overloader<ReturnType,
 //-----------------------------------------------------------------------------
 
 template <typename CharT>
-basic_decoder<CharT>::basic_decoder(const view_type& view)
-    : input(view)
+basic_decoder<CharT>::basic_decoder(const view_type& view, bool mutable_input)
+    : input(view),
+      mutable_input(mutable_input)
 {
     current.code = token::detail::code::error_uninitialized;
+    current.escaped = false;
+    current.unescaped = view_type();
+    current.magnitude = 0;
+    current.overflow = false;
     next();
 }
 
+template <typename CharT>
+basic_decoder<CharT>::basic_decoder(token::detail::code::value code,
+                                    const view_type& literal,
+                                    bool escaped) BOOST_NOEXCEPT
+    : input(literal.data() + literal.size(), 0),
+      mutable_input(false)
+{
+    current.code = code;
+    current.view = literal;
+    current.escaped = escaped;
+    current.unescaped = view_type();
+    current.magnitude = 0;
+    current.overflow = false;
+    if (code == token::detail::code::integer)
+    {
+        const CharT *first = literal.data();
+        if (*first == traits<CharT>::alpha_minus)
+            ++first;
+        scanner<CharT>::parse_digits(first,
+                                     literal.data() + literal.size(),
+                                     current.magnitude,
+                                     current.overflow);
+    }
+}
+
 template <typename CharT>
 void basic_decoder<CharT>::code(token::detail::code::value code) BOOST_NOEXCEPT
 {
@@ -161,6 +192,7 @@ void basic_decoder<CharT>::next() BOOST_NOEXCEPT
     case token::detail::code::error_unbalanced_end_object:
     case token::detail::code::error_expected_end_array:
     case token::detail::code::error_expected_end_object:
+    case token::detail::code::error_nesting_limit:
         return;
     case token::detail::code::end:
         current.code = token::detail::code::error_unexpected_token;
@@ -258,6 +290,22 @@ ReturnType basic_decoder<CharT>::signed_integer_value() const
     const bool is_negative = (*it == traits<CharT>::alpha_minus);
     if (is_negative)
     {
+        if (!current.overflow || (std::numeric_limits<ReturnType>::digits <= 64))
+        {
+            // Use magnitude converted by next_number()
+            using unsigned_type = typename std::make_unsigned<ReturnType>::type;
+            // Computed in unsigned_type, which may be wider than the magnitude
+            const unsigned_type limit = unsigned_type(std::numeric_limits<ReturnType>::max()) + 1U;
+            if (current.overflow || (current.magnitude > limit))
+            {
+                current.code = token::detail::code::error_invalid_value;
+                throw json::error(error());
+            }
+            if (current.magnitude == 0)
+                return ReturnType();
+            return -ReturnType(current.magnitude - 1) - ReturnType(1);
+        }
+
         ++it; // Skip minus
 
         ReturnType result = ReturnType();
@@ -272,7 +320,7 @@ ReturnType basic_decoder<CharT>::signed_integer_value() const
             result *= ReturnType(10);
 
             const ReturnType digit = ReturnType(traits<CharT>::to_int(*it));
-            if (lowest + digit > result + 1) {
+            if (lowest + digit > result) {
                 // Overflow
                 current.code = token::detail::code::error_invalid_value;
                 throw json::error(error());
@@ -304,6 +352,17 @@ ReturnType basic_decoder<CharT>::unsigned_integer_value() const
         throw json::error(error());
     }
 
+    if (!current.overflow || (std::numeric_limits<ReturnType>::digits <= 64))
+    {
+        // Use magnitude converted by next_number()
+        if (current.overflow || (current.magnitude > std::uint64_t(std::numeric_limits<ReturnType>::max())))
+        {
+            current.code = token::detail::code::error_invalid_value;
+            throw json::error(error());
+        }
+        return ReturnType(current.magnitude);
+    }
+
     ReturnType result = ReturnType();
     const ReturnType max = std::numeric_limits<ReturnType>::max();
     while (it != literal().end())
@@ -343,101 +402,214 @@ std::basic_string<CharT> basic_decoder<CharT>::string_value() const
     // FIXME: Validate string [ http://www.w3.org/International/questions/qa-forms-utf-8 ]
     assert(current.code == token::detail::code::string);
 
-    const typename view_type::size_type  approximateSize = literal().size();
-    assert(approximateSize >= 2);
+    const view_type content = unquoted_literal();
+    if (!current.escaped)
+        return std::basic_string<CharT>(content.data(), content.size());
+
+    if (mutable_input)
+    {
+        const view_type unescaped = unescape_in_situ();
+        return std::basic_string<CharT>(unescaped.data(), unescaped.size());
+    }
 
     std::basic_string<CharT> result;
-    result.reserve(approximateSize);
+    result.reserve(content.size());
+    unescape(result);
+    return result;
+}
+
+template <typename CharT>
+auto basic_decoder<CharT>::string_view(std::basic_string<CharT>& scratch) const -> view_type
+{
+    if (code() != token::detail::code::string)
+    {
+        current.code = token::detail::code::error_incompatible_type;
+        throw json::error(error());
+    }
+    if (!current.escaped)
+        return unquoted_literal();
+
+    if (mutable_input)
+        return unescape_in_situ();
+
+    scratch.clear();
+    unescape(scratch);
+    return view_type(scratch.data(), scratch.size());
+}
 
-    typename view_type::const_iterator begin = literal().begin();
-    typename view_type::const_iterator end = literal().end();
-    for (typename view_type::const_iterator it = begin;
-         it != end;
-         ++it)
+template <typename CharT>
+void basic_decoder<CharT>::relocate(const view_type& buffer,
+                                    size_type literal_offset,
+                                    size_type input_offset) BOOST_NOEXCEPT
+{
+    assert(literal_offset + current.view.size() <= buffer.size());
+    assert(input_offset <= buffer.size());
+
+    if (current.unescaped.data() != nullptr)
     {
-        if (*it == traits<CharT>::alpha_reverse_solidus)
+        const size_type unescaped_offset = literal_offset + size_type(current.unescaped.data() - current.view.data());
+        current.unescaped = view_type(buffer.data() + unescaped_offset, current.unescaped.size());
+    }
+    current.view = view_type(buffer.data() + literal_offset, current.view.size());
+    input = view_type(buffer.data() + input_offset, buffer.size() - input_offset);
+}
+
+template <typename CharT>
+void basic_decoder<CharT>::seek(const value_type *position) BOOST_NOEXCEPT
+{
+    assert(position >= input.data());
+    assert(position <= input.data() + input.size());
+
+    input.remove_prefix(size_type(position - input.data()));
+    next();
+}
+
+template <typename CharT>
+auto basic_decoder<CharT>::unquoted_literal() const BOOST_NOEXCEPT -> view_type
+{
+    assert(current.code == token::detail::code::string);
+    assert(literal().size() >= 2);
+
+    return view_type(literal().data() + 1, literal().size() - 2);
+}
+
+// Output for unescaping a string token into its own storage. Unescaped
+// strings are never longer than their escaped form, so the output position
+// never overtakes the input position.
+template <typename CharT>
+class in_situ_output
+{
+public:
+    in_situ_output(CharT *position) BOOST_NOEXCEPT
+        : position(position)
+    {}
+
+    void append(const CharT *first, const CharT *last) BOOST_NOEXCEPT
+    {
+        const std::size_t size = std::size_t(last - first);
+        std::char_traits<CharT>::move(position, first, size);
+        position += size;
+    }
+
+    in_situ_output& operator+= (CharT value) BOOST_NOEXCEPT
+    {
+        *position++ = value;
+        return *this;
+    }
+
+    CharT *data() const BOOST_NOEXCEPT
+    {
+        return position;
+    }
+
+private:
+    CharT *position;
+};
+
+template <typename CharT>
+auto basic_decoder<CharT>::unescape_in_situ() const BOOST_NOEXCEPT -> view_type
+{
+    assert(mutable_input);
+    assert(current.escaped);
+
+    // The token must not be unescaped twice
+    if (current.unescaped.data() != nullptr)
+        return current.unescaped;
+
+    // The constructor was told that the input buffer is writable
+    value_type *first = const_cast<value_type *>(unquoted_literal().data());
+    in_situ_output<CharT> output(first);
+    unescape(output);
+    current.unescaped = view_type(first, size_type(output.data() - first));
+    return current.unescaped;
+}
+
+template <typename CharT>
+template <typename Output>
+void basic_decoder<CharT>::unescape(Output& result) const
+{
+    const view_type content = unquoted_literal();
+    typename view_type::const_iterator it = content.begin();
+    typename view_type::const_iterator end = content.end();
+    while (it != end)
+    {
+        // Copy run of unescaped characters
+        typename view_type::const_iterator escape = std::find(it, end, value_type(traits<CharT>::alpha_reverse_solidus));
+        result.append(it, escape);
+        if (escape == end)
+            break;
+
+        it = escape + 1;
+        assert(it != end);
+        switch (*it)
         {
-            assert(std::distance(it, end) >= 2);
-            ++it;
-            switch (*it)
-            {
-            case traits<CharT>::alpha_quote:
-            case traits<CharT>::alpha_reverse_solidus:
-            case traits<CharT>::alpha_solidus:
-                result += *it;
-                break;
+        case traits<CharT>::alpha_quote:
+        case traits<CharT>::alpha_reverse_solidus:
+        case traits<CharT>::alpha_solidus:
+            result += *it;
+            break;
 
-            case traits<CharT>::alpha_b:
-                result += traits<CharT>::alpha_backspace;
-                break;
+        case traits<CharT>::alpha_b:
+            result += traits<CharT>::alpha_backspace;
+            break;
 
-            case traits<CharT>::alpha_f:
-                result += traits<CharT>::alpha_formfeed;
-                break;
+        case traits<CharT>::alpha_f:
+            result += traits<CharT>::alpha_formfeed;
+            break;
 
-            case traits<CharT>::alpha_n:
-                result += traits<CharT>::alpha_newline;
-                break;
+        case traits<CharT>::alpha_n:
+            result += traits<CharT>::alpha_newline;
+            break;
 
-            case traits<CharT>::alpha_r:
-                result += traits<CharT>::alpha_return;
-                break;
+        case traits<CharT>::alpha_r:
+            result += traits<CharT>::alpha_return;
+            break;
 
-            case traits<CharT>::alpha_t:
-                result += traits<CharT>::alpha_tab;
-                break;
+        case traits<CharT>::alpha_t:
+            result += traits<CharT>::alpha_tab;
+            break;
 
-            case traits<CharT>::alpha_u:
+        case traits<CharT>::alpha_u:
+            {
+                // Convert \uXXXX value to UTF-8
+                assert(std::distance(it, end) >= 5);
+                std::uint32_t number = 0;
+                for (int i = 0; i < 4; ++i)
                 {
-                    // Convert \uXXXX value to UTF-8
-                    assert(std::distance(it, end) >= 5);
-                    std::uint32_t number = 0;
-                    for (int i = 0; i < 4; ++i)
+                    ++it;
+                    number <<= 4;
+                    if (traits<CharT>::is_hexdigit(*it))
                     {
-                        ++it;
-                        number <<= 4;
-                        if (traits<CharT>::is_hexdigit(*it))
-                        {
-                            number += std::uint32_t(traits<CharT>::to_int(*it));
-                        }
-                    }
-                    if (number <= 0x007F)
-                    {
-                        // 0xxxxxxx
-                        result += std::char_traits<CharT>::to_char_type(number & 0x7F);
-                    }
-                    else if (number <= 0x07FF)
-                    {
-                        // 110xxxxx 10xxxxxx
-                        result += 0xC0 | std::char_traits<CharT>::to_char_type((number >> 6) & 0x1F);
-                        result += 0x80 | std::char_traits<CharT>::to_char_type(number & 0x3F);
-                    }
-                    else
-                    {
-                        // 1110xxxx 10xxxxxx 10xxxxxx
-                        result += 0xE0 | std::char_traits<CharT>::to_char_type((number >> 12) & 0x0F);
-                        result += 0x80 | std::char_traits<CharT>::to_char_type((number >> 6) & 0x3F);
-                        result += 0x80 | std::char_traits<CharT>::to_char_type(number & 0x3F);
+                        number += std::uint32_t(traits<CharT>::to_int(*it));
                     }
                 }
-                break;
-
-            default:
-                assert(false);
-                break;
+                if (number <= 0x007F)
+                {
+                    // 0xxxxxxx
+                    result += std::char_traits<CharT>::to_char_type(number & 0x7F);
+                }
+                else if (number <= 0x07FF)
+                {
+                    // 110xxxxx 10xxxxxx
+                    result += 0xC0 | std::char_traits<CharT>::to_char_type((number >> 6) & 0x1F);
+                    result += 0x80 | std::char_traits<CharT>::to_char_type(number & 0x3F);
+                }
+                else
+                {
+                    // 1110xxxx 10xxxxxx 10xxxxxx
+                    result += 0xE0 | std::char_traits<CharT>::to_char_type((number >> 12) & 0x0F);
+                    result += 0x80 | std::char_traits<CharT>::to_char_type((number >> 6) & 0x3F);
+                    result += 0x80 | std::char_traits<CharT>::to_char_type(number & 0x3F);
+                }
             }
+            break;
+
+        default:
+            assert(false);
+            break;
         }
-        else if (*it == traits<CharT>::alpha_quote)
-        {
-            assert((it == begin) || (it + 1 == end));
-            // Ignore initial and terminating quotes
-        }
-        else
-        {
-            result += *it;
-        }
+        ++it;
     }
-    return result;
 }
 
 template <typename CharT>
@@ -452,6 +624,12 @@ auto basic_decoder<CharT>::tail() const BOOST_NOEXCEPT -> const view_type&
     return input;
 }
 
+template <typename CharT>
+bool basic_decoder<CharT>::escaped() const BOOST_NOEXCEPT
+{
+    return current.escaped;
+}
+
 template <typename CharT>
 token::detail::code::value basic_decoder<CharT>::next_token(token::detail::code::value type) BOOST_NOEXCEPT
 {
@@ -569,6 +747,8 @@ token::detail::code::value basic_decoder<CharT>::next_number() BOOST_NOEXCEPT
 
     {
         typename view_type::const_iterator digit_begin = input.begin();
+        current.magnitude = 0;
+        current.overflow = false;
         if (input.front() == traits<CharT>::alpha_0)
         {
             input.remove_prefix(1);
@@ -581,10 +761,12 @@ token::detail::code::value basic_decoder<CharT>::next_number() BOOST_NOEXCEPT
         }
         else
         {
-            while (!input.empty() && traits<CharT>::is_digit(input.front()))
-            {
-                input.remove_prefix(1);
-            }
+            // Integer part is converted while it is scanned
+            const CharT *digit_end = scanner<CharT>::parse_digits(input.data(),
+                                                                  input.data() + input.size(),
+                                                                  current.magnitude,
+                                                                  current.overflow);
+            input.remove_prefix(size_type(digit_end - input.data()));
         }
         if (input.begin() == digit_begin)
         {
@@ -670,13 +852,21 @@ token::detail::code::value basic_decoder<CharT>::next_string() BOOST_NOEXCEPT
     typename view_type::const_iterator marker = input.begin();
     typename view_type::const_iterator end = input.end();
     ++marker; // Skip initial '"'
+    current.escaped = false;
+    current.unescaped = view_type();
     while (marker != end)
     {
+        // Skip run of characters that need no further inspection
+        marker = scanner<CharT>::find_string_special(marker, end);
+        if (marker == end)
+            break;
+
         switch (traits<CharT>::to_category(*marker++))
         {
         case traits_category::escape:
             {
                 // Handle escaped character
+                current.escaped = true;
                 if (marker == end)
                     goto eof;
                 switch (*marker++)
@@ -803,16 +993,8 @@ token::detail::code::value basic_decoder<CharT>::next_string() BOOST_NOEXCEPT
 template <typename CharT>
 void basic_decoder<CharT>::skip_whitespaces() BOOST_NOEXCEPT
 {
-    typename view_type::size_type size = typename view_type::size_type();
-    typename view_type::const_iterator end = input.end();
-    for (typename view_type::const_iterator it = input.begin();
-         it != end;
-         ++it)
-    {
-        if (!traits<CharT>::is_space(*it))
-            break;
-        ++size;
-    }
+    const CharT *marker = scanner<CharT>::skip_whitespaces(input.begin(), input.end());
+    const typename view_type::size_type size = marker - input.begin();
     if (size > 0)
     {
         input.remove_prefix(size);
@@ -18,6 +18,8 @@
 #include <trial/protocol/core/detail/string_view.hpp>
 #include <trial/protocol/core/char_traits.hpp>
 #include <trial/protocol/buffer/base.hpp>
+#include <trial/protocol/buffer/detail/storage.hpp>
+#include <trial/protocol/json/real_format.hpp>
 
 namespace trial
 {
@@ -28,19 +30,22 @@ namespace json
 namespace detail
 {
 
-template <typename CharT, std::size_t N>
+// The encoder writes into a type-erased buffer if OutputType is void, and
+// directly into a buffer for OutputType otherwise.
+template <typename CharT, std::size_t N, typename OutputType = void>
 class basic_encoder
 {
+    using storage_type = buffer::detail::storage<CharT, N, OutputType>;
+
 public:
     using value_type = CharT;
     using size_type = std::size_t;
-    using buffer_type = buffer::base<value_type>;
+    using buffer_type = typename storage_type::buffer_type;
     using string_type = std::basic_string<value_type, core::char_traits<value_type>>;
     using view_type = core::detail::basic_string_view<value_type, core::char_traits<value_type>>;
 
     template <typename T>
-    basic_encoder(T&);
-    ~basic_encoder();
+    basic_encoder(T&, json::real_format = json::real_format::fixed_precision);
 
     //! @brief Write value
     //!
@@ -62,6 +67,7 @@ private:
     template <typename T> size_type integral_value(const T&);
     template <typename T> size_type floating_value(const T&);
     template <typename T> size_type string_value(const T&);
+    size_type escape_value(value_type);
     size_type null_value();
     size_type begin_array_value();
     size_type end_array_value();
@@ -78,7 +84,8 @@ private:
     const buffer_type& buffer() const;
 
 private:
-    typename std::aligned_storage<N>::type storage;
+    storage_type storage;
+    json::real_format format;
 };
 
 } // namespace detail
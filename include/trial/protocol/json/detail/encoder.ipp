@@ -12,10 +12,10 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <cmath>
-#include <iterator>
-#include <array>
 #include <type_traits>
-#include <trial/protocol/buffer/base.hpp>
+#include <trial/protocol/json/detail/integer_encoder.hpp>
+#include <trial/protocol/json/detail/real_encoder.hpp>
+#include <trial/protocol/json/detail/scan.hpp>
 #include <trial/protocol/json/detail/string_converter.hpp>
 #include <trial/protocol/json/detail/traits.hpp>
 #include <trial/protocol/json/token.hpp>
@@ -29,141 +29,111 @@ namespace json
 namespace detail
 {
 
-template <typename T, typename Enable = void>
-struct absolute
-{
-    static T value(T value)
-    {
-        return std::abs(value);
-    }
-};
-
-template <typename T>
-struct absolute<T,
-                typename std::enable_if<std::is_unsigned<T>::value>::type>
-{
-    static T value(T value)
-    {
-        return value;
-    }
-};
-
-template <typename T>
-struct absolute<T,
-                typename std::enable_if<std::is_same<T, signed char>::value ||
-                                        std::is_same<T, signed short>::value>::type>
-{
-    static T value(T value)
-    {
-        return value < 0 ? -value : value;
-    }
-};
-
 //-----------------------------------------------------------------------------
 // encoder::overloader
 //-----------------------------------------------------------------------------
 
-template <typename CharT, std::size_t N>
+template <typename CharT, std::size_t N, typename OutputType>
 template <typename T, typename Enable>
-struct basic_encoder<CharT, N>::overloader
+struct basic_encoder<CharT, N, OutputType>::overloader
 {
 };
 
 // Tags
 
-template <typename CharT, std::size_t N>
+template <typename CharT, std::size_t N, typename OutputType>
 template <typename T>
-struct basic_encoder<CharT, N>::overloader<
+struct basic_encoder<CharT, N, OutputType>::overloader<
     T,
     typename std::enable_if<std::is_same<T, token::null>::value>::type>
 {
-    using size_type = typename basic_encoder<CharT, N>::size_type;
+    using size_type = typename basic_encoder<CharT, N, OutputType>::size_type;
 
-    inline static size_type write(basic_encoder<CharT, N>& self)
+    inline static size_type write(basic_encoder<CharT, N, OutputType>& self)
     {
         return self.null_value();
     }
 };
 
-template <typename CharT, std::size_t N>
+template <typename CharT, std::size_t N, typename OutputType>
 template <typename T>
-struct basic_encoder<CharT, N>::overloader<
+struct basic_encoder<CharT, N, OutputType>::overloader<
     T,
     typename std::enable_if<std::is_same<T, token::begin_array>::value>::type>
 {
-    using size_type = typename basic_encoder<CharT, N>::size_type;
+    using size_type = typename basic_encoder<CharT, N, OutputType>::size_type;
 
-    inline static size_type write(basic_encoder<CharT, N>& self)
+    inline static size_type write(basic_encoder<CharT, N, OutputType>& self)
     {
         return self.begin_array_value();
     }
 };
 
-template <typename CharT, std::size_t N>
+template <typename CharT, std::size_t N, typename OutputType>
 template <typename T>
-struct basic_encoder<CharT, N>::overloader<
+struct basic_encoder<CharT, N, OutputType>::overloader<
     T,
     typename std::enable_if<std::is_same<T, token::end_array>::value>::type>
 {
-    using size_type = typename basic_encoder<CharT, N>::size_type;
+    using size_type = typename basic_encoder<CharT, N, OutputType>::size_type;
 
-    inline static size_type write(basic_encoder<CharT, N>& self)
+    inline static size_type write(basic_encoder<CharT, N, OutputType>& self)
     {
         return self.end_array_value();
     }
 };
 
-template <typename CharT, std::size_t N>
+template <typename CharT, std::size_t N, typename OutputType>
 template <typename T>
-struct basic_encoder<CharT, N>::overloader<
+struct basic_encoder<CharT, N, OutputType>::overloader<
     T,
     typename std::enable_if<std::is_same<T, token::begin_object>::value>::type>
 {
-    using size_type = typename basic_encoder<CharT, N>::size_type;
+    using size_type = typename basic_encoder<CharT, N, OutputType>::size_type;
 
-    inline static size_type write(basic_encoder<CharT, N>& self)
+    inline static size_type write(basic_encoder<CharT, N, OutputType>& self)
     {
         return self.begin_object_value();
     }
 };
 
-template <typename CharT, std::size_t N>
+template <typename CharT, std::size_t N, typename OutputType>
 template <typename T>
-struct basic_encoder<CharT, N>::overloader<
+struct basic_encoder<CharT, N, OutputType>::overloader<
     T,
     typename std::enable_if<std::is_same<T, token::end_object>::value>::type>
 {
-    using size_type = typename basic_encoder<CharT, N>::size_type;
+    using size_type = typename basic_encoder<CharT, N, OutputType>::size_type;
 
-    inline static size_type write(basic_encoder<CharT, N>& self)
+    inline static size_type write(basic_encoder<CharT, N, OutputType>& self)
     {
         return self.end_object_value();
     }
 };
 
-template <typename CharT, std::size_t N>
+template <typename CharT, std::size_t N, typename OutputType>
 template <typename T>
-struct basic_encoder<CharT, N>::overloader<
+struct basic_encoder<CharT, N, OutputType>::overloader<
     T,
     typename std::enable_if<std::is_same<T, token::detail::value_separator>::value>::type>
 {
-    using size_type = typename basic_encoder<CharT, N>::size_type;
+    using size_type = typename basic_encoder<CharT, N, OutputType>::size_type;
 
-    static size_type write(basic_encoder<CharT, N>& self)
+    static size_type write(basic_encoder<CharT, N, OutputType>& self)
     {
         return self.value_separator_value();
     }
 };
 
-template <typename CharT, std::size_t N>
+template <typename CharT, std::size_t N, typename OutputType>
 template <typename T>
-struct basic_encoder<CharT, N>::overloader<
+struct basic_encoder<CharT, N, OutputType>::overloader<
     T,
     typename std::enable_if<std::is_same<T, token::detail::name_separator>::value>::type>
 {
-    using size_type = typename basic_encoder<CharT, N>::size_type;
+    using size_type = typename basic_encoder<CharT, N, OutputType>::size_type;
 
-    static size_type write(basic_encoder<CharT, N>& self)
+    static size_type write(basic_encoder<CharT, N, OutputType>& self)
     {
         return self.name_separator_value();
     }
@@ -171,15 +141,15 @@ struct basic_encoder<CharT, N>::overloader<
 
 // Integers
 
-template <typename CharT, std::size_t N>
+template <typename CharT, std::size_t N, typename OutputType>
 template <typename T>
-struct basic_encoder<CharT, N>::overloader<
+struct basic_encoder<CharT, N, OutputType>::overloader<
     T,
     typename std::enable_if<std::is_integral<T>::value>::type>
 {
-    using size_type = typename basic_encoder<CharT, N>::size_type;
+    using size_type = typename basic_encoder<CharT, N, OutputType>::size_type;
 
-    inline static size_type write(basic_encoder<CharT, N>& self,
+    inline static size_type write(basic_encoder<CharT, N, OutputType>& self,
                                   const T& data)
     {
         return self.integral_value(data);
@@ -188,15 +158,15 @@ struct basic_encoder<CharT, N>::overloader<
 
 // Floating point numbers
 
-template <typename CharT, std::size_t N>
+template <typename CharT, std::size_t N, typename OutputType>
 template <typename T>
-struct basic_encoder<CharT, N>::overloader<
+struct basic_encoder<CharT, N, OutputType>::overloader<
     T,
     typename std::enable_if<std::is_floating_point<T>::value>::type>
 {
-    using size_type = typename basic_encoder<CharT, N>::size_type;
+    using size_type = typename basic_encoder<CharT, N, OutputType>::size_type;
 
-    inline static size_type write(basic_encoder<CharT, N>& self,
+    inline static size_type write(basic_encoder<CharT, N, OutputType>& self,
                                   const T& data)
     {
         return self.floating_value(data);
@@ -205,31 +175,31 @@ struct basic_encoder<CharT, N>::overloader<
 
 // Strings
 
-template <typename CharT, std::size_t N>
+template <typename CharT, std::size_t N, typename OutputType>
 template <typename T>
-struct basic_encoder<CharT, N>::overloader<
+struct basic_encoder<CharT, N, OutputType>::overloader<
     T,
-    typename std::enable_if<std::is_same<T, typename basic_encoder<CharT, N>::view_type>::value>::type>
+    typename std::enable_if<std::is_same<T, typename basic_encoder<CharT, N, OutputType>::view_type>::value>::type>
 {
-    using size_type = typename basic_encoder<CharT, N>::size_type;
-    using view_type = typename basic_encoder<CharT, N>::view_type;
+    using size_type = typename basic_encoder<CharT, N, OutputType>::size_type;
+    using view_type = typename basic_encoder<CharT, N, OutputType>::view_type;
 
-    static size_type write(basic_encoder<CharT, N>& self,
+    static size_type write(basic_encoder<CharT, N, OutputType>& self,
                            const view_type& data)
     {
         return self.string_value(data);
     }
 };
 
-template <typename CharT, std::size_t N>
+template <typename CharT, std::size_t N, typename OutputType>
 template <typename T>
-struct basic_encoder<CharT, N>::overloader<
+struct basic_encoder<CharT, N, OutputType>::overloader<
     T,
     typename std::enable_if<std::is_same<T, std::basic_string<CharT> >::value>::type>
 {
-    using size_type = typename basic_encoder<CharT, N>::size_type;
+    using size_type = typename basic_encoder<CharT, N, OutputType>::size_type;
 
-    static size_type write(basic_encoder<CharT, N>& self,
+    static size_type write(basic_encoder<CharT, N, OutputType>& self,
                            const std::basic_string<CharT>& data)
     {
         return self.string_value(data);
@@ -237,34 +207,26 @@ struct basic_encoder<CharT, N>::overloader<
 };
 
 //-----------------------------------------------------------------------------
-// basic_encoder<CharT, N>
+// basic_encoder<CharT, N, OutputType>
 //-----------------------------------------------------------------------------
 
-template <typename CharT, std::size_t N>
+template <typename CharT, std::size_t N, typename OutputType>
 template <typename T>
-basic_encoder<CharT, N>::basic_encoder(T& output)
-{
-    static_assert(N >= sizeof(typename buffer::traits<T>::buffer_type),
-                  "N is smaller than buffer_type");
-
-    ::new (std::addressof(storage)) typename buffer::traits<T>::buffer_type(output);
-}
-
-template <typename CharT, std::size_t N>
-basic_encoder<CharT, N>::~basic_encoder()
+basic_encoder<CharT, N, OutputType>::basic_encoder(T& output, json::real_format format)
+    : storage(output),
+      format(format)
 {
-    buffer().~buffer_type();
 }
 
-template <typename CharT, std::size_t N>
+template <typename CharT, std::size_t N, typename OutputType>
 template <typename U>
-auto basic_encoder<CharT, N>::value(const U& data) -> size_type
+auto basic_encoder<CharT, N, OutputType>::value(const U& data) -> size_type
 {
-    return basic_encoder<CharT, N>::overloader<U>::write(*this, data);
+    return basic_encoder<CharT, N, OutputType>::overloader<U>::write(*this, data);
 }
 
-template <typename CharT, std::size_t N>
-auto basic_encoder<CharT, N>::value(bool data) -> size_type
+template <typename CharT, std::size_t N, typename OutputType>
+auto basic_encoder<CharT, N, OutputType>::value(bool data) -> size_type
 {
     if (data)
     {
@@ -276,73 +238,38 @@ auto basic_encoder<CharT, N>::value(bool data) -> size_type
     }
 }
 
-template <typename CharT, std::size_t N>
-auto basic_encoder<CharT, N>::value(const value_type *data) -> size_type
+template <typename CharT, std::size_t N, typename OutputType>
+auto basic_encoder<CharT, N, OutputType>::value(const value_type *data) -> size_type
 {
-    return basic_encoder<CharT, N>::overloader<view_type>::write(*this, data);
+    return basic_encoder<CharT, N, OutputType>::overloader<view_type>::write(*this, data);
 }
 
-template <typename CharT, std::size_t N>
+template <typename CharT, std::size_t N, typename OutputType>
 template <typename U>
-auto basic_encoder<CharT, N>::value() -> size_type
+auto basic_encoder<CharT, N, OutputType>::value() -> size_type
 {
-    return basic_encoder<CharT, N>::overloader<U>::write(*this);
+    return basic_encoder<CharT, N, OutputType>::overloader<U>::write(*this);
 }
 
-template <typename CharT, std::size_t N>
-auto basic_encoder<CharT, N>::literal(const view_type& data) -> size_type
+template <typename CharT, std::size_t N, typename OutputType>
+auto basic_encoder<CharT, N, OutputType>::literal(const view_type& data) -> size_type
 {
     return write(data);
 }
 
-template <typename CharT, std::size_t N>
+template <typename CharT, std::size_t N, typename OutputType>
 template <typename T>
-auto basic_encoder<CharT, N>::integral_value(const T& data) -> size_type
+auto basic_encoder<CharT, N, OutputType>::integral_value(const T& data) -> size_type
 {
-    std::array<value_type, std::numeric_limits<T>::digits10 + 1> output;
-
-    // Build buffer backwards
-    typename decltype(output)::reverse_iterator where = output.rbegin();
-    const bool is_negative = data < 0;
-    using unsigned_type = typename std::make_unsigned<T>::type;
-    auto number = unsigned_type(detail::absolute<T>::value(data));
-    if (number == 0)
-    {
-        *where = traits<CharT>::alpha_0;
-        ++where;
-    }
-    else
-    {
-        const T base = T(10);
-        while (number != 0)
-        {
-            *where = traits<CharT>::alpha_0 + (number % base);
-            ++where;
-            number /= base;
-        }
-    }
-    typename decltype(output)::const_iterator begin = where.base();
-    const size_type size = size_type(std::distance(begin, output.cend()) + (is_negative ? 1 : 0));
-
-    if (!buffer().grow(size))
-    {
-        return 0;
-    }
-    if (is_negative)
-    {
-        buffer().write(traits<CharT>::alpha_minus);
-    }
-    while (begin != output.end())
-    {
-        buffer().write(*begin);
-        ++begin;
-    }
-    return size;
+    value_type output[integer_encoder<CharT, T>::max_length];
+    value_type *end = integer_encoder<CharT, T>::encode(data, output);
+    // Reserve and write the whole number at once
+    return write(view_type(output, size_type(end - output)));
 }
 
-template <typename CharT, std::size_t N>
+template <typename CharT, std::size_t N, typename OutputType>
 template <typename T>
-auto basic_encoder<CharT, N>::floating_value(const T& data) -> size_type
+auto basic_encoder<CharT, N, OutputType>::floating_value(const T& data) -> size_type
 {
     switch (std::fpclassify(data))
     {
@@ -351,13 +278,21 @@ auto basic_encoder<CharT, N>::floating_value(const T& data) -> size_type
         // Infinity and NaN must be encoded as null
         return write(traits<CharT>::null_text());
     default:
-        return write(detail::string_converter<CharT, T>::encode(data));
+        break;
+    }
+
+    if (format == json::real_format::shortest)
+    {
+        value_type output[real_encoder<CharT, T>::max_length];
+        value_type *end = real_encoder<CharT, T>::encode(data, output);
+        return write(view_type(output, size_type(end - output)));
     }
+    return write(detail::string_converter<CharT, T>::encode(data));
 }
 
-template <typename CharT, std::size_t N>
+template <typename CharT, std::size_t N, typename OutputType>
 template <typename T>
-auto basic_encoder<CharT, N>::string_value(const T& data) -> size_type
+auto basic_encoder<CharT, N, OutputType>::string_value(const T& data) -> size_type
 {
     // This is an approximation of the size. Further characters may be
     // added by escaped characters, in which case we grow the buffer
@@ -370,52 +305,57 @@ auto basic_encoder<CharT, N>::string_value(const T& data) -> size_type
     }
 
     buffer().write(traits<CharT>::alpha_quote);
-    typename T::const_iterator it = data.begin();
-    while (it != data.end())
+    const value_type *it = data.data();
+    const value_type *last = it + data.size();
+    while (it != last)
     {
+        // Copy characters that need no escaping in a single write
+        const value_type *special = scanner<CharT>::find_escape(it, last);
+        if (special != it)
+        {
+            buffer().write(view_type(it, size_type(special - it)));
+            it = special;
+            if (it == last)
+                break;
+        }
+
         switch (*it)
         {
         case traits<CharT>::alpha_quote:
         case traits<CharT>::alpha_reverse_solidus:
         case traits<CharT>::alpha_solidus:
-            if (write(traits<CharT>::alpha_reverse_solidus) == 0)
+            if (escape_value(*it) == 0)
                 return 0;
-            buffer().write(*it);
             ++size;
             break;
 
         case traits<CharT>::alpha_backspace:
-            if (write(traits<CharT>::alpha_reverse_solidus) == 0)
+            if (escape_value(traits<CharT>::alpha_b) == 0)
                 return 0;
-            buffer().write(traits<CharT>::alpha_b);
             ++size;
             break;
 
         case traits<CharT>::alpha_formfeed:
-            if (write(traits<CharT>::alpha_reverse_solidus) == 0)
+            if (escape_value(traits<CharT>::alpha_f) == 0)
                 return 0;
-            buffer().write(traits<CharT>::alpha_f);
             ++size;
             break;
 
         case traits<CharT>::alpha_newline:
-            if (write(traits<CharT>::alpha_reverse_solidus) == 0)
+            if (escape_value(traits<CharT>::alpha_n) == 0)
                 return 0;
-            buffer().write(traits<CharT>::alpha_n);
             ++size;
             break;
 
         case traits<CharT>::alpha_return:
-            if (write(traits<CharT>::alpha_reverse_solidus) == 0)
+            if (escape_value(traits<CharT>::alpha_r) == 0)
                 return 0;
-            buffer().write(traits<CharT>::alpha_r);
             ++size;
             break;
 
         case traits<CharT>::alpha_tab:
-            if (write(traits<CharT>::alpha_reverse_solidus) == 0)
+            if (escape_value(traits<CharT>::alpha_t) == 0)
                 return 0;
-            buffer().write(traits<CharT>::alpha_t);
             ++size;
             break;
 
@@ -433,8 +373,8 @@ auto basic_encoder<CharT, N>::string_value(const T& data) -> size_type
             else if ((*it & 0xE0) == 0xC0)
             {
                 // 110xxxxx
-                typename T::value_type first = *it;
-                if (++it == data.end())
+                value_type first = *it;
+                if (++it == last)
                 {
                     if (write(traits<CharT>::alpha_question_mark) == 0)
                         return 0;
@@ -451,8 +391,8 @@ auto basic_encoder<CharT, N>::string_value(const T& data) -> size_type
             else if ((*it & 0xF0) == 0xE0)
             {
                 // 1110xxxx
-                typename T::value_type first = *it;
-                if (++it == data.end())
+                value_type first = *it;
+                if (++it == last)
                 {
                     if (write(traits<CharT>::alpha_question_mark) == 0)
                         return 0;
@@ -461,8 +401,8 @@ auto basic_encoder<CharT, N>::string_value(const T& data) -> size_type
                 if ((*it & 0xC0) == 0x80)
                 {
                     // 1110xxxx 10xxxxxx
-                    typename T::value_type second = *it;
-                    if (++it == data.end())
+                    value_type second = *it;
+                    if (++it == last)
                     {
                         if (write(traits<CharT>::alpha_question_mark) == 0)
                             return 0;
@@ -489,50 +429,57 @@ auto basic_encoder<CharT, N>::string_value(const T& data) -> size_type
     return size;
 }
 
-template <typename CharT, std::size_t N>
-auto basic_encoder<CharT, N>::null_value() -> size_type
+template <typename CharT, std::size_t N, typename OutputType>
+auto basic_encoder<CharT, N, OutputType>::escape_value(value_type data) -> size_type
+{
+    const value_type sequence[] = { traits<CharT>::alpha_reverse_solidus, data };
+    return write(view_type(sequence, sizeof(sequence) / sizeof(sequence[0])));
+}
+
+template <typename CharT, std::size_t N, typename OutputType>
+auto basic_encoder<CharT, N, OutputType>::null_value() -> size_type
 {
     return write(traits<CharT>::null_text());
 }
 
-template <typename CharT, std::size_t N>
-auto basic_encoder<CharT, N>::begin_array_value() -> size_type
+template <typename CharT, std::size_t N, typename OutputType>
+auto basic_encoder<CharT, N, OutputType>::begin_array_value() -> size_type
 {
     return write(traits<CharT>::alpha_bracket_open);
 }
 
-template <typename CharT, std::size_t N>
-auto basic_encoder<CharT, N>::end_array_value() -> size_type
+template <typename CharT, std::size_t N, typename OutputType>
+auto basic_encoder<CharT, N, OutputType>::end_array_value() -> size_type
 {
     return write(traits<CharT>::alpha_bracket_close);
 }
 
-template <typename CharT, std::size_t N>
-auto basic_encoder<CharT, N>::begin_object_value() -> size_type
+template <typename CharT, std::size_t N, typename OutputType>
+auto basic_encoder<CharT, N, OutputType>::begin_object_value() -> size_type
 {
     return write(traits<CharT>::alpha_brace_open);
 }
 
-template <typename CharT, std::size_t N>
-auto basic_encoder<CharT, N>::end_object_value() -> size_type
+template <typename CharT, std::size_t N, typename OutputType>
+auto basic_encoder<CharT, N, OutputType>::end_object_value() -> size_type
 {
     return write(traits<CharT>::alpha_brace_close);
 }
 
-template <typename CharT, std::size_t N>
-auto basic_encoder<CharT, N>::value_separator_value() -> size_type
+template <typename CharT, std::size_t N, typename OutputType>
+auto basic_encoder<CharT, N, OutputType>::value_separator_value() -> size_type
 {
     return write(traits<CharT>::alpha_comma);
 }
 
-template <typename CharT, std::size_t N>
-auto basic_encoder<CharT, N>::name_separator_value() -> size_type
+template <typename CharT, std::size_t N, typename OutputType>
+auto basic_encoder<CharT, N, OutputType>::name_separator_value() -> size_type
 {
     return write(traits<CharT>::alpha_colon);
 }
 
-template <typename CharT, std::size_t N>
-auto basic_encoder<CharT, N>::write(value_type character) -> size_type
+template <typename CharT, std::size_t N, typename OutputType>
+auto basic_encoder<CharT, N, OutputType>::write(value_type character) -> size_type
 {
     const size_type size = sizeof(character);
     if (buffer().grow(size))
@@ -543,8 +490,8 @@ auto basic_encoder<CharT, N>::write(value_type character) -> size_type
     return 0;
 }
 
-template <typename CharT, std::size_t N>
-auto basic_encoder<CharT, N>::write(const view_type& data) -> size_type
+template <typename CharT, std::size_t N, typename OutputType>
+auto basic_encoder<CharT, N, OutputType>::write(const view_type& data) -> size_type
 {
     const typename view_type::size_type size = data.size();
     if (buffer().grow(size))
@@ -555,8 +502,8 @@ auto basic_encoder<CharT, N>::write(const view_type& data) -> size_type
     return 0;
 }
 
-template <typename CharT, std::size_t N>
-auto basic_encoder<CharT, N>::write(const string_type& data) -> size_type
+template <typename CharT, std::size_t N, typename OutputType>
+auto basic_encoder<CharT, N, OutputType>::write(const string_type& data) -> size_type
 {
     const typename view_type::size_type size = data.size();
     if (buffer().grow(size))
@@ -567,16 +514,16 @@ auto basic_encoder<CharT, N>::write(const string_type& data) -> size_type
     return 0;
 }
 
-template <typename CharT, std::size_t N>
-auto basic_encoder<CharT, N>::buffer() -> buffer_type&
+template <typename CharT, std::size_t N, typename OutputType>
+auto basic_encoder<CharT, N, OutputType>::buffer() -> buffer_type&
 {
-    return reinterpret_cast<buffer_type&>(storage);
+    return storage.get();
 }
 
-template <typename CharT, std::size_t N>
-auto basic_encoder<CharT, N>::buffer() const -> const buffer_type&
+template <typename CharT, std::size_t N, typename OutputType>
+auto basic_encoder<CharT, N, OutputType>::buffer() const -> const buffer_type&
 {
-    return reinterpret_cast<const buffer_type&>(storage);
+    return storage.get();
 }
 
 } // namespace detail
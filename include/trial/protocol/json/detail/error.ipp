@@ -58,6 +58,12 @@ public:
 
         case insufficient_tokens:
             return "algorithm used requires more tokens than available";
+
+        case nesting_limit:
+            return "maximum nesting level exceeded";
+
+        case invalid_path:
+            return "invalid path expression";
         }
         return "trial.protocol.json error";
     }
@@ -99,6 +105,9 @@ inline enum errc to_errc(token::code::value value)
     case token::code::error_expected_end_object:
         return expected_end_object;
 
+    case token::code::error_nesting_limit:
+        return nesting_limit;
+
     default:
         return no_error;
     }
@@ -43,6 +43,12 @@ struct basic_formatter
         writer.template value<json::token::null>();
     }
 
+    // Strings may use another allocator or string type than the writer
+    void operator()(const typename variable_type::string_type& value)
+    {
+        writer.value(typename json::basic_writer<CharT>::view_type(value.data(), value.size()));
+    }
+
     void operator()(const typename variable_type::wstring_type&)
     {
         throw json::error(json::incompatible_type);
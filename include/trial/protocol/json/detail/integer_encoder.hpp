@@ -0,0 +1,170 @@
+#ifndef TRIAL_PROTOCOL_JSON_DETAIL_INTEGER_ENCODER_HPP
+#define TRIAL_PROTOCOL_JSON_DETAIL_INTEGER_ENCODER_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+// Formatting of integers.
+//
+// The number of digits is counted first, so the digits can be written from
+// the end towards the front without a reversal step. Two digits are emitted
+// per division by looking them up in a table of all pairs from 00 to 99.
+
+#include <cstddef> // std::size_t
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <boost/config.hpp>
+#include <trial/protocol/json/detail/traits.hpp>
+
+namespace trial
+{
+namespace protocol
+{
+namespace json
+{
+namespace detail
+{
+namespace integer
+{
+
+inline const char *digit_pairs() BOOST_NOEXCEPT
+{
+    static const char table[] =
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899";
+    return table;
+}
+
+template <typename U>
+int count_digits(U value) BOOST_NOEXCEPT
+{
+    // Four comparisons per division keep the number of divisions low
+    int result = 1;
+    while (true)
+    {
+        if (value < 10)
+            return result;
+        if (value < 100)
+            return result + 1;
+        if (value < 1000)
+            return result + 2;
+        if (value < 10000)
+            return result + 3;
+        value /= 10000U;
+        result += 4;
+    }
+}
+
+// Write value into [output, output + length) where length is the number of
+// digits in value.
+template <typename CharT, typename U>
+void write_digits(U value, CharT *output, int length) BOOST_NOEXCEPT
+{
+    const char *pairs = digit_pairs();
+    CharT *where = output + length;
+    while (value >= 100)
+    {
+        const std::size_t index = std::size_t(value % 100) * 2;
+        value /= 100;
+        *--where = CharT(pairs[index + 1]);
+        *--where = CharT(pairs[index]);
+    }
+    if (value >= 10)
+    {
+        const std::size_t index = std::size_t(value) * 2;
+        *--where = CharT(pairs[index + 1]);
+        *--where = CharT(pairs[index]);
+    }
+    else
+    {
+        *--where = CharT(traits<CharT>::alpha_0 + CharT(value));
+    }
+}
+
+// Unsigned type that holds the magnitude of T. Divisions on 32-bit integers
+// are faster than on 64-bit integers, so narrow types are widened to 32 bits.
+template <typename T, typename Enable = void>
+struct magnitude
+{
+    using type = typename std::make_unsigned<T>::type;
+};
+
+template <typename T>
+struct magnitude<T, typename std::enable_if<(sizeof(T) <= sizeof(std::uint32_t))>::type>
+{
+    using type = std::uint32_t;
+};
+
+template <typename T>
+struct magnitude<T, typename std::enable_if<(sizeof(T) > sizeof(std::uint32_t)) && (sizeof(T) <= sizeof(std::uint64_t))>::type>
+{
+    using type = std::uint64_t;
+};
+
+template <typename T>
+bool is_negative(T value, std::true_type) BOOST_NOEXCEPT
+{
+    return value < 0;
+}
+
+template <typename T>
+bool is_negative(T, std::false_type) BOOST_NOEXCEPT
+{
+    return false;
+}
+
+} // namespace integer
+
+template <typename CharT, typename T, typename Enable = void>
+struct integer_encoder;
+
+//! @brief Decimal formatting of integral types.
+template <typename CharT, typename T>
+struct integer_encoder<CharT,
+                       T,
+                       typename std::enable_if<std::is_integral<T>::value>::type>
+{
+    // Digits and sign
+    static const std::size_t max_length = std::numeric_limits<T>::digits10 + 2;
+
+    //! @brief Write value to output.
+    //!
+    //! @returns Position after the last character.
+    static CharT *encode(T value, CharT *output) BOOST_NOEXCEPT
+    {
+        using unsigned_type = typename integer::magnitude<T>::type;
+        unsigned_type magnitude = unsigned_type(value);
+        if (integer::is_negative(value, std::is_signed<T>()))
+        {
+            *output++ = traits<CharT>::alpha_minus;
+            // Negate in unsigned arithmetic to handle the minimum value
+            magnitude = unsigned_type(0) - magnitude;
+        }
+        const int length = integer::count_digits(magnitude);
+        integer::write_digits(magnitude, output, length);
+        return output + length;
+    }
+};
+
+} // namespace detail
+} // namespace json
+} // namespace protocol
+} // namespace trial
+
+#endif // TRIAL_PROTOCOL_JSON_DETAIL_INTEGER_ENCODER_HPP
@@ -0,0 +1,179 @@
+#ifndef TRIAL_PROTOCOL_JSON_DETAIL_LAZY_IPP
+#define TRIAL_PROTOCOL_JSON_DETAIL_LAZY_IPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <system_error>
+#include <trial/protocol/json/error.hpp>
+#include <trial/protocol/json/parse.hpp>
+#include <trial/protocol/json/partial/skip.hpp>
+
+namespace trial
+{
+namespace protocol
+{
+namespace json
+{
+
+template <template <typename> class Allocator>
+basic_lazy<Allocator>::basic_lazy(const view_type& view)
+    : expanded(false)
+{
+    json::reader reader(view);
+    current = reader.symbol();
+    switch (current)
+    {
+    case token::symbol::end:
+        throw json::error(make_error_code(json::unexpected_token));
+
+    case token::symbol::error:
+        throw json::error(reader.error());
+
+    case token::symbol::end_array:
+        throw json::error(make_error_code(json::unbalanced_end_array));
+
+    case token::symbol::end_object:
+        throw json::error(make_error_code(json::unbalanced_end_object));
+
+    default:
+        break;
+    }
+    std::error_code error;
+    input = partial::skip_unchecked(reader, error);
+    if (error)
+        throw json::error(error);
+}
+
+template <template <typename> class Allocator>
+basic_lazy<Allocator>::basic_lazy(const view_type& literal, token::symbol::value symbol)
+    : input(literal),
+      current(symbol),
+      expanded(false)
+{
+}
+
+template <template <typename> class Allocator>
+token::symbol::value basic_lazy<Allocator>::symbol() const BOOST_NOEXCEPT
+{
+    return current;
+}
+
+template <template <typename> class Allocator>
+auto basic_lazy<Allocator>::literal() const BOOST_NOEXCEPT -> const view_type&
+{
+    return input;
+}
+
+template <template <typename> class Allocator>
+auto basic_lazy<Allocator>::size() const -> size_type
+{
+    return entries().size();
+}
+
+template <template <typename> class Allocator>
+auto basic_lazy<Allocator>::operator[](size_type index) const -> basic_lazy
+{
+    if (current != token::symbol::begin_array)
+        throw json::error(make_error_code(json::incompatible_type));
+    const auto& all = entries();
+    if (index >= all.size())
+        throw std::out_of_range("json::lazy index");
+    return basic_lazy(all[index].literal, all[index].symbol);
+}
+
+template <template <typename> class Allocator>
+auto basic_lazy<Allocator>::operator[](const std::string& key) const -> basic_lazy
+{
+    const entry *where = find(key);
+    if (!where)
+        throw std::out_of_range("json::lazy key");
+    return basic_lazy(where->literal, where->symbol);
+}
+
+template <template <typename> class Allocator>
+auto basic_lazy<Allocator>::count(const std::string& key) const -> size_type
+{
+    return find(key) ? 1 : 0;
+}
+
+template <template <typename> class Allocator>
+auto basic_lazy<Allocator>::value() const -> variable_type
+{
+    return json::parse<view_type, Allocator>(input);
+}
+
+template <template <typename> class Allocator>
+auto basic_lazy<Allocator>::find(const std::string& key) const -> const entry *
+{
+    if (current != token::symbol::begin_object)
+        throw json::error(make_error_code(json::incompatible_type));
+    for (const auto& member : entries())
+    {
+        if (member.key == key)
+            return &member;
+    }
+    return nullptr;
+}
+
+template <template <typename> class Allocator>
+auto basic_lazy<Allocator>::entries() const -> const std::vector<entry>&
+{
+    if (expanded)
+        return elements;
+
+    // Locate the immediate elements without decoding nested containers
+    json::reader reader(input);
+    std::error_code error;
+    switch (current)
+    {
+    case token::symbol::begin_array:
+        reader.next();
+        while (reader.symbol() != token::symbol::end_array)
+        {
+            if (reader.symbol() == token::symbol::error)
+                throw json::error(reader.error());
+            const auto symbol = reader.symbol();
+            const auto literal = partial::skip_unchecked(reader, error);
+            if (error)
+                throw json::error(error);
+            elements.push_back({ std::string(), literal, symbol });
+        }
+        break;
+
+    case token::symbol::begin_object:
+        reader.next();
+        while (reader.symbol() == token::symbol::string)
+        {
+            auto key = reader.template value<std::string>();
+            if (!reader.next())
+                throw json::error(reader.error());
+            const auto symbol = reader.symbol();
+            const auto literal = partial::skip_unchecked(reader, error);
+            if (error)
+                throw json::error(error);
+            elements.push_back({ std::move(key), literal, symbol });
+        }
+        if (reader.symbol() != token::symbol::end_object)
+            throw json::error(make_error_code(json::expected_end_object));
+        break;
+
+    default:
+        throw json::error(make_error_code(json::incompatible_type));
+    }
+    expanded = true;
+    return elements;
+}
+
+} // namespace json
+} // namespace protocol
+} // namespace trial
+
+#endif // TRIAL_PROTOCOL_JSON_DETAIL_LAZY_IPP
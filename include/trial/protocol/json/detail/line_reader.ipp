@@ -0,0 +1,75 @@
+#ifndef TRIAL_PROTOCOL_JSON_DETAIL_LINE_READER_IPP
+#define TRIAL_PROTOCOL_JSON_DETAIL_LINE_READER_IPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <trial/protocol/json/detail/scan.hpp>
+#include <trial/protocol/json/detail/traits.hpp>
+
+namespace trial
+{
+namespace protocol
+{
+namespace json
+{
+
+template <typename CharT>
+basic_line_reader<CharT>::basic_line_reader(const view_type& input) BOOST_NOEXCEPT
+    : current(input.data(), 0),
+      remaining(input)
+{
+}
+
+template <typename CharT>
+bool basic_line_reader<CharT>::next() BOOST_NOEXCEPT
+{
+    const value_type *first = remaining.data();
+    const value_type *last = first + remaining.size();
+
+    // Skip blank lines
+    first = detail::scanner<CharT>::skip_whitespaces(first, last);
+    if (first == last)
+    {
+        current = view_type(last, 0);
+        remaining = current;
+        return false;
+    }
+
+    const value_type *newline = std::char_traits<value_type>::find(first,
+                                                                   size_type(last - first),
+                                                                   value_type(detail::traits<CharT>::alpha_newline));
+    if (newline == nullptr)
+    {
+        newline = last;
+    }
+    current = view_type(first, size_type(newline - first));
+    remaining = view_type(newline, size_type(last - newline));
+    return true;
+}
+
+template <typename CharT>
+auto basic_line_reader<CharT>::literal() const BOOST_NOEXCEPT -> const view_type&
+{
+    return current;
+}
+
+template <typename CharT>
+auto basic_line_reader<CharT>::tail() const BOOST_NOEXCEPT -> const view_type&
+{
+    return remaining;
+}
+
+} // namespace json
+} // namespace protocol
+} // namespace trial
+
+#endif // TRIAL_PROTOCOL_JSON_DETAIL_LINE_READER_IPP
@@ -0,0 +1,187 @@
+#ifndef TRIAL_PROTOCOL_JSON_DETAIL_PARALLEL_PARSE_IPP
+#define TRIAL_PROTOCOL_JSON_DETAIL_PARALLEL_PARSE_IPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <algorithm>
+#include <string>
+#include <system_error>
+#include <vector>
+#include <trial/protocol/core/detail/parallel.hpp>
+#include <trial/protocol/json/error.hpp>
+#include <trial/protocol/json/parse.hpp>
+#include <trial/protocol/json/reader.hpp>
+#include <trial/protocol/json/partial/skip.hpp>
+#include <trial/protocol/json/detail/traits.hpp>
+
+namespace trial
+{
+namespace protocol
+{
+namespace json
+{
+namespace detail
+{
+
+template <template <typename> class Allocator>
+class parallel_parser
+{
+public:
+    using variable_type = dynamic::basic_variable<Allocator>;
+    using array_type = typename variable_type::array_type;
+    using view_type = json::reader::view_type;
+    using size_type = std::size_t;
+
+    parallel_parser(const view_type& input)
+        : input(input)
+    {}
+
+    variable_type parse(size_type concurrency)
+    {
+        json::reader reader(input);
+        if ((concurrency <= 1) || (reader.symbol() != token::symbol::begin_array))
+            return json::parse<view_type, Allocator>(input);
+
+        split(reader);
+
+        const auto tasks = std::min(concurrency, elements.size());
+        const auto bounds = partition(tasks);
+
+        // Each task decodes into its own variables, so the allocators of the
+        // result are only used by the calling thread
+        std::vector<std::vector<variable_type>> decoded(tasks);
+        core::detail::parallel_invoke(
+            tasks,
+            [this, &decoded, &bounds] (size_type task)
+            {
+                auto& output = decoded[task];
+                output.reserve(bounds[task + 1] - bounds[task]);
+                for (auto k = bounds[task]; k < bounds[task + 1]; ++k)
+                {
+                    output.push_back(json::parse<view_type, Allocator>(elements[k]));
+                }
+            });
+
+        auto result = dynamic::basic_array<Allocator>::make();
+        auto& items = result.template assume_value<array_type>();
+        items.reserve(elements.size());
+        for (auto& output : decoded)
+        {
+            for (auto& item : output)
+            {
+                items.push_back(std::move(item));
+            }
+        }
+        return result;
+    }
+
+private:
+    // Locate the elements of the outer array without decoding them
+    void split(json::reader& reader)
+    {
+        assert(reader.symbol() == token::symbol::begin_array);
+
+        reader.next();
+        while (true)
+        {
+            switch (reader.symbol())
+            {
+            case token::symbol::end_array:
+                reader.next();
+                if (reader.symbol() != token::symbol::end)
+                    throw json::error(make_error_code(json::unexpected_token));
+                return;
+
+            case token::symbol::end_object:
+                throw json::error(make_error_code(json::unbalanced_end_object));
+
+            case token::symbol::end:
+            case token::symbol::error:
+                throw json::error(make_error_code(json::expected_end_array));
+
+            default:
+                {
+                    // The content of containers is validated when decoded
+                    std::error_code error;
+                    const auto element = partial::skip_unchecked(reader, error);
+                    if (error)
+                        throw json::error(make_error_code(json::expected_end_array));
+                    elements.push_back(element);
+                }
+                break;
+            }
+        }
+    }
+
+    // Divide elements into contiguous ranges with roughly the same number of
+    // input characters, so tasks finish at about the same time regardless of
+    // variations in element sizes.
+    std::vector<size_type> partition(size_type tasks) const
+    {
+        std::vector<size_type> bounds(tasks + 1, elements.size());
+        bounds[0] = 0;
+        if (elements.empty())
+            return bounds;
+
+        const auto first = elements.front().data();
+        const auto total = size_type(elements.back().data() + elements.back().size() - first);
+        size_type k = 0;
+        for (size_type task = 1; task < tasks; ++task)
+        {
+            const auto target = total / tasks * task;
+            while ((k < elements.size()) && (size_type(elements[k].data() - first) < target))
+            {
+                ++k;
+            }
+            bounds[task] = k;
+        }
+        return bounds;
+    }
+
+    view_type input;
+    std::vector<view_type> elements;
+};
+
+// Divide newline-delimited input into chunks of roughly equal size that end
+// at line boundaries
+inline std::vector<json::reader::view_type> split_lines(const json::reader::view_type& input,
+                                                         std::size_t tasks)
+{
+    using view_type = json::reader::view_type;
+    using traits_type = std::char_traits<view_type::value_type>;
+
+    std::vector<view_type> chunks;
+    const char *first = input.data();
+    const char *last = first + input.size();
+    for (std::size_t task = 1; task < tasks; ++task)
+    {
+        const char *target = input.data() + input.size() / tasks * task;
+        if (target < first)
+            continue;
+        const char *newline = traits_type::find(target,
+                                                std::size_t(last - target),
+                                                char(traits<char>::alpha_newline));
+        if (newline == nullptr)
+            break;
+        chunks.emplace_back(first, std::size_t(newline + 1 - first));
+        first = newline + 1;
+    }
+    chunks.emplace_back(first, std::size_t(last - first));
+    return chunks;
+}
+
+} // namespace detail
+} // namespace json
+} // namespace protocol
+} // namespace trial
+
+#endif // TRIAL_PROTOCOL_JSON_DETAIL_PARALLEL_PARSE_IPP
@@ -13,6 +13,8 @@
 
 #include <cassert>
 #include <limits>
+#include <string>
+#include <trial/dynamic/string_pool.hpp>
 #include <trial/protocol/json/error.hpp>
 #include <trial/protocol/json/reader.hpp>
 #include <trial/protocol/json/detail/compact.hpp>
@@ -26,16 +28,61 @@ namespace json
 namespace detail
 {
 
+// Constructs the keys of objects
+template <typename CharT, typename StringType>
+class key_factory
+{
+public:
+    StringType operator()(const CharT *data, std::size_t size)
+    {
+        return StringType(data, size);
+    }
+};
+
+// Shared keys are interned, so the keys of repeated records share storage
+template <typename CharT>
+class key_factory<CharT, dynamic::detail::basic_shared_string<CharT>>
+{
+public:
+    using pool_type = dynamic::basic_string_pool<CharT>;
+
+    key_factory()
+        : pool(&local)
+    {}
+
+    key_factory(pool_type& pool)
+        : pool(&pool)
+    {}
+
+    dynamic::detail::basic_shared_string<CharT> operator()(const CharT *data, std::size_t size)
+    {
+        return pool->intern(data, size);
+    }
+
+private:
+    pool_type local;
+    pool_type *pool;
+};
+
 template <typename CharT, template <typename> class Allocator>
 class basic_parser
 {
 public:
     using variable_type = dynamic::basic_variable<Allocator>;
+    using string_type = typename variable_type::string_type;
+    using map_type = typename variable_type::map_type;
 
     basic_parser(basic_reader<CharT>& reader)
         : reader(reader)
     {}
 
+    // Only available when keys are interned
+    basic_parser(basic_reader<CharT>& reader,
+                 dynamic::basic_string_pool<CharT>& pool)
+        : reader(reader),
+          make_key(pool)
+    {}
+
     // Parse outer scope
     variable_type parse()
     {
@@ -117,17 +164,19 @@ private:
         assert(reader.symbol() == token::symbol::begin_object);
 
         auto scope = dynamic::basic_map<Allocator>::make();
+        // Members are moved directly into the map
+        auto& members = scope.template assume_value<map_type>();
 
         while (reader.next())
         {
             // Key
-            std::string key;
+            string_type key;
             switch (reader.symbol())
             {
             case token::symbol::end_object:
                 return scope;
             case token::symbol::string:
-                key = reader.template value<std::string>();
+                key = key_value();
                 break;
             default:
                 throw json::error(make_error_code(json::invalid_key));
@@ -140,11 +189,11 @@ private:
             switch (reader.symbol())
             {
             case token::symbol::begin_array:
-                scope.insert({ key, parse_array() });
+                members.emplace(std::move(key), parse_array());
                 break;
 
             case token::symbol::begin_object:
-                scope.insert({ key, parse_object() });
+                members.emplace(std::move(key), parse_object());
                 break;
 
             case token::symbol::end_array:
@@ -158,7 +207,7 @@ private:
                 break;
 
             default:
-                scope.insert({ key, parse_value() });
+                members.emplace(std::move(key), parse_value());
                 break;
             }
         }
@@ -193,14 +242,29 @@ private:
             return compact<variable_type>(reader.template value<long double>());
 
         case token::symbol::string:
-            return reader.template value<std::string>();
+            return string_value();
 
         default:
             throw json::error(make_error_code(json::unexpected_token));
         }
     }
 
+    string_type string_value()
+    {
+        // Strings are constructed directly with the allocator of the variable
+        const auto view = reader.string_view(scratch);
+        return string_type(view.data(), view.size());
+    }
+
+    string_type key_value()
+    {
+        const auto view = reader.string_view(scratch);
+        return make_key(view.data(), view.size());
+    }
+
     json::basic_reader<CharT>& reader;
+    std::basic_string<CharT> scratch;
+    key_factory<CharT, string_type> make_key;
 };
 
 } // namespace detail
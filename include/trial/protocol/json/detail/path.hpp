@@ -0,0 +1,226 @@
+#ifndef TRIAL_PROTOCOL_JSON_DETAIL_PATH_HPP
+#define TRIAL_PROTOCOL_JSON_DETAIL_PATH_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef> // std::size_t
+#include <limits>
+#include <string>
+#include <vector>
+#include <trial/protocol/core/detail/string_view.hpp>
+#include <trial/protocol/core/char_traits.hpp>
+#include <trial/protocol/json/detail/traits.hpp>
+
+namespace trial
+{
+namespace protocol
+{
+namespace json
+{
+namespace detail
+{
+
+//-----------------------------------------------------------------------------
+// JSON Pointer (RFC 6901)
+//-----------------------------------------------------------------------------
+
+// Split pointer into unescaped reference tokens.
+//
+// Returns false if the pointer is malformed.
+template <typename CharT>
+bool parse_pointer(const core::detail::basic_string_view<CharT, core::char_traits<CharT>>& pointer,
+                   std::vector<std::basic_string<CharT>>& tokens)
+{
+    using traits_type = json::detail::traits<CharT>;
+
+    tokens.clear();
+    if (pointer.empty())
+        return true;
+    if (pointer.front() != traits_type::alpha_solidus)
+        return false;
+
+    for (auto it = pointer.begin() + 1; ; ++it)
+    {
+        tokens.emplace_back();
+        auto& token = tokens.back();
+        for (; (it != pointer.end()) && (*it != traits_type::alpha_solidus); ++it)
+        {
+            if (*it == CharT('~'))
+            {
+                if (++it == pointer.end())
+                    return false;
+                if (*it == traits_type::alpha_0)
+                    token += CharT('~');
+                else if (*it == traits_type::alpha_1)
+                    token += traits_type::alpha_solidus;
+                else
+                    return false;
+            }
+            else
+            {
+                token += *it;
+            }
+        }
+        if (it == pointer.end())
+            return true;
+    }
+}
+
+// Convert reference token into array index.
+//
+// Returns false if the token is not a decimal number without leading zeros.
+template <typename CharT>
+bool to_index(const std::basic_string<CharT>& token, std::size_t& result)
+{
+    using traits_type = json::detail::traits<CharT>;
+
+    if (token.empty())
+        return false;
+    if ((token[0] == traits_type::alpha_0) && (token.size() > 1))
+        return false;
+
+    result = 0;
+    for (auto ch : token)
+    {
+        if ((ch < traits_type::alpha_0) || (ch > traits_type::alpha_9))
+            return false;
+        const std::size_t digit = std::size_t(ch - traits_type::alpha_0);
+        if (result > (std::numeric_limits<std::size_t>::max() - digit) / 10)
+            return false;
+        result = result * 10 + digit;
+    }
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// JSONPath
+//
+// Supported subset:
+//
+//   $              Root value
+//   .name          Object member
+//   ['name']       Object member (also with double quotes)
+//   [n]            Array element
+//   .* or [*]      All members or elements
+//-----------------------------------------------------------------------------
+
+template <typename CharT>
+struct path_segment
+{
+    enum kind_type
+    {
+        key,
+        index,
+        wildcard
+    };
+
+    kind_type kind;
+    std::basic_string<CharT> name;
+    std::size_t position;
+};
+
+// Returns false if the path is malformed or uses unsupported syntax.
+template <typename CharT>
+bool parse_path(const core::detail::basic_string_view<CharT, core::char_traits<CharT>>& path,
+                std::vector<path_segment<CharT>>& segments)
+{
+    using traits_type = json::detail::traits<CharT>;
+    using segment_type = path_segment<CharT>;
+    const CharT alpha_dollar = CharT('$');
+    const CharT alpha_asterisk = CharT('*');
+    const CharT alpha_apostrophe = CharT('\'');
+
+    segments.clear();
+    auto it = path.begin();
+    if ((it == path.end()) || (*it != alpha_dollar))
+        return false;
+    ++it;
+
+    while (it != path.end())
+    {
+        segment_type segment{ segment_type::key, {}, 0 };
+
+        if (*it == traits_type::alpha_dot)
+        {
+            ++it;
+            if ((it != path.end()) && (*it == alpha_asterisk))
+            {
+                segment.kind = segment_type::wildcard;
+                ++it;
+            }
+            else
+            {
+                for (; (it != path.end()) && (*it != traits_type::alpha_dot) && (*it != traits_type::alpha_bracket_open); ++it)
+                {
+                    segment.name += *it;
+                }
+                if (segment.name.empty())
+                    return false;
+            }
+        }
+        else if (*it == traits_type::alpha_bracket_open)
+        {
+            if (++it == path.end())
+                return false;
+
+            if (*it == alpha_asterisk)
+            {
+                segment.kind = segment_type::wildcard;
+                ++it;
+            }
+            else if ((*it == alpha_apostrophe) || (*it == traits_type::alpha_quote))
+            {
+                const CharT delimiter = *it++;
+                for (; (it != path.end()) && (*it != delimiter); ++it)
+                {
+                    if (*it == traits_type::alpha_reverse_solidus)
+                    {
+                        if (++it == path.end())
+                            return false;
+                    }
+                    segment.name += *it;
+                }
+                if (it == path.end())
+                    return false;
+                ++it;
+            }
+            else
+            {
+                std::basic_string<CharT> digits;
+                for (; (it != path.end()) && (*it != traits_type::alpha_bracket_close); ++it)
+                {
+                    digits += *it;
+                }
+                if (!to_index(digits, segment.position))
+                    return false;
+                segment.kind = segment_type::index;
+            }
+
+            if ((it == path.end()) || (*it != traits_type::alpha_bracket_close))
+                return false;
+            ++it;
+        }
+        else
+        {
+            return false;
+        }
+
+        segments.push_back(std::move(segment));
+    }
+    return true;
+}
+
+} // namespace detail
+} // namespace json
+} // namespace protocol
+} // namespace trial
+
+#endif // TRIAL_PROTOCOL_JSON_DETAIL_PATH_HPP
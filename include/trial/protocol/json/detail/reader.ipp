@@ -14,6 +14,7 @@
 #include <cmath>
 #include <type_traits>
 #include <trial/protocol/core/detail/type_traits.hpp>
+#include <trial/protocol/json/detail/scan.hpp>
 
 namespace trial
 {
@@ -26,22 +27,22 @@ namespace json
 // reader::overloader
 //-----------------------------------------------------------------------------
 
-template <typename CharT>
+template <typename CharT, std::size_t N>
 template <typename ReturnType, typename Enable>
-struct basic_reader<CharT>::overloader
+struct basic_reader<CharT, N>::overloader
 {
 };
 
 // Integers (not booleans)
 
-template <typename CharT>
+template <typename CharT, std::size_t N>
 template <typename ReturnType>
-struct basic_reader<CharT>::overloader<
+struct basic_reader<CharT, N>::overloader<
     ReturnType,
     typename std::enable_if<std::is_integral<ReturnType>::value &&
                             !core::detail::is_bool<ReturnType>::value>::type>
 {
-    inline static ReturnType value(const basic_reader<CharT>& self)
+    inline static ReturnType value(const basic_reader<CharT, N>& self)
     {
         return self.template integer_value<ReturnType>();
     }
@@ -49,13 +50,13 @@ struct basic_reader<CharT>::overloader<
 
 // Floating-point numbers
 
-template <typename CharT>
+template <typename CharT, std::size_t N>
 template <typename ReturnType>
-struct basic_reader<CharT>::overloader<
+struct basic_reader<CharT, N>::overloader<
     ReturnType,
     typename std::enable_if<std::is_floating_point<ReturnType>::value>::type>
 {
-    inline static ReturnType value(const basic_reader<CharT>& self)
+    inline static ReturnType value(const basic_reader<CharT, N>& self)
     {
         return self.template real_value<ReturnType>();
     }
@@ -63,13 +64,13 @@ struct basic_reader<CharT>::overloader<
 
 // Booleans
 
-template <typename CharT>
+template <typename CharT, std::size_t N>
 template <typename ReturnType>
-struct basic_reader<CharT>::overloader<
+struct basic_reader<CharT, N>::overloader<
     ReturnType,
     typename std::enable_if<core::detail::is_bool<ReturnType>::value>::type>
 {
-    inline static ReturnType value(const basic_reader<CharT>& self)
+    inline static ReturnType value(const basic_reader<CharT, N>& self)
     {
         return self.template bool_value<ReturnType>();
     }
@@ -77,15 +78,15 @@ struct basic_reader<CharT>::overloader<
 
 // Strings
 
-template <typename CharT>
+template <typename CharT, std::size_t N>
 template <typename ReturnType>
-struct basic_reader<CharT>::overloader<
+struct basic_reader<CharT, N>::overloader<
     ReturnType,
     typename std::enable_if<std::is_same< ReturnType, std::basic_string<CharT> >::value>::type>
 {
     using return_type = std::basic_string<CharT>;
 
-    inline static return_type value(const basic_reader<CharT>& self)
+    inline static return_type value(const basic_reader<CharT, N>& self)
     {
         return self.template string_value<return_type>();
     }
@@ -95,59 +96,86 @@ struct basic_reader<CharT>::overloader<
 // basic_reader
 //-----------------------------------------------------------------------------
 
-template <typename CharT>
-basic_reader<CharT>::basic_reader(const view_type& input)
-    : decoder(input)
+template <typename CharT, std::size_t N>
+basic_reader<CharT, N>::basic_reader(const view_type& input, size_type max_level)
+    : decoder(input),
+      max_level(max_level)
 {
     stack.push(token::detail::code::end);
     decoder.code(stack.top().check_outer(decoder));
 }
 
-template <typename CharT>
-basic_reader<CharT>::basic_reader(const basic_reader<CharT>& other)
-    : decoder(other.decoder)
+template <typename CharT, std::size_t N>
+basic_reader<CharT, N>::basic_reader(in_situ_t,
+                                     value_type *buffer,
+                                     size_type size,
+                                     size_type max_level)
+    : decoder(view_type(buffer, size), true),
+      max_level(max_level)
+{
+    stack.push(token::detail::code::end);
+    decoder.code(stack.top().check_outer(decoder));
+}
+
+template <typename CharT, std::size_t N>
+basic_reader<CharT, N>::basic_reader(const basic_reader<CharT, N>& other)
+    : decoder(other.decoder),
+      max_level(other.max_level)
 {
     stack.push(token::detail::code::end);
 }
 
-template <typename CharT>
-auto basic_reader<CharT>::level() const BOOST_NOEXCEPT -> size_type
+template <typename CharT, std::size_t N>
+basic_reader<CharT, N>::basic_reader(const detail::basic_decoder<value_type>& decoder)
+    : decoder(decoder),
+      max_level(std::numeric_limits<size_type>::max())
+{
+    stack.push(token::detail::code::end);
+}
+
+template <typename CharT, std::size_t N>
+auto basic_reader<CharT, N>::level() const BOOST_NOEXCEPT -> size_type
 {
     assert(stack.size() > 0);
     return stack.size() - 1;
 }
 
-template <typename CharT>
-token::code::value basic_reader<CharT>::code() const BOOST_NOEXCEPT
+template <typename CharT, std::size_t N>
+token::code::value basic_reader<CharT, N>::code() const BOOST_NOEXCEPT
 {
     return token::detail::convert(decoder.code());
 }
 
-template <typename CharT>
-token::symbol::value basic_reader<CharT>::symbol() const BOOST_NOEXCEPT
+template <typename CharT, std::size_t N>
+token::symbol::value basic_reader<CharT, N>::symbol() const BOOST_NOEXCEPT
 {
     return token::symbol::convert(code());
 }
 
-template <typename CharT>
-token::category::value basic_reader<CharT>::category() const BOOST_NOEXCEPT
+template <typename CharT, std::size_t N>
+token::category::value basic_reader<CharT, N>::category() const BOOST_NOEXCEPT
 {
     return token::category::convert(code());
 }
 
-template <typename CharT>
-std::error_code basic_reader<CharT>::error() const BOOST_NOEXCEPT
+template <typename CharT, std::size_t N>
+std::error_code basic_reader<CharT, N>::error() const BOOST_NOEXCEPT
 {
     return decoder.error();
 }
 
-template <typename CharT>
-bool basic_reader<CharT>::next()
+template <typename CharT, std::size_t N>
+bool basic_reader<CharT, N>::next()
 {
     const token::detail::code::value current = decoder.code();
     switch (current)
     {
     case token::detail::code::begin_array:
+        if (level() >= max_level)
+        {
+            decoder.code(token::detail::code::error_nesting_limit);
+            return false;
+        }
         stack.push(token::detail::code::end_array);
         break;
 
@@ -166,6 +194,11 @@ bool basic_reader<CharT>::next()
         break;
 
     case token::detail::code::begin_object:
+        if (level() >= max_level)
+        {
+            decoder.code(token::detail::code::error_nesting_limit);
+            return false;
+        }
         stack.push(token::detail::code::end_object);
         break;
 
@@ -199,8 +232,8 @@ bool basic_reader<CharT>::next()
     return (category() != token::category::status);
 }
 
-template <typename CharT>
-bool basic_reader<CharT>::next(token::code::value expect)
+template <typename CharT, std::size_t N>
+bool basic_reader<CharT, N>::next(token::code::value expect)
 {
     const token::code::value current = code();
     if (current != expect)
@@ -211,29 +244,79 @@ bool basic_reader<CharT>::next(token::code::value expect)
     return next();
 }
 
-template <typename CharT>
+template <typename CharT, std::size_t N>
+bool basic_reader<CharT, N>::skip_container(const value_type *end)
+{
+    token::detail::code::value scope;
+    switch (decoder.code())
+    {
+    case token::detail::code::begin_array:
+        scope = token::detail::code::end_array;
+        break;
+
+    case token::detail::code::begin_object:
+        scope = token::detail::code::end_object;
+        break;
+
+    default:
+        return next();
+    }
+
+    if (level() >= max_level)
+    {
+        decoder.code(token::detail::code::error_nesting_limit);
+        return false;
+    }
+
+    if (!end)
+    {
+        const auto& input = decoder.tail();
+        const value_type *last = input.data() + input.size();
+        end = detail::find_container_end(decoder.literal().data(), last);
+        if (end == last)
+        {
+            decoder.code((scope == token::detail::code::end_array)
+                         ? token::detail::code::error_expected_end_array
+                         : token::detail::code::error_expected_end_object);
+            return false;
+        }
+    }
+
+    // Continue as if the end token of the container has been reached
+    stack.push(scope);
+    decoder.seek(end);
+    return next();
+}
+
+template <typename CharT, std::size_t N>
 template <typename T>
-T basic_reader<CharT>::value() const
+T basic_reader<CharT, N>::value() const
 {
     using return_type = typename std::remove_cv<typename std::decay<T>::type>::type;
-    return basic_reader<CharT>::overloader<return_type>::value(*this);
+    return basic_reader<CharT, N>::overloader<return_type>::value(*this);
+}
+
+template <typename CharT, std::size_t N>
+auto basic_reader<CharT, N>::string_view(std::basic_string<value_type>& scratch) const -> view_type
+{
+    return decoder.string_view(scratch);
 }
 
-template <typename CharT>
-auto basic_reader<CharT>::literal() const BOOST_NOEXCEPT -> const view_type&
+template <typename CharT, std::size_t N>
+auto basic_reader<CharT, N>::literal() const BOOST_NOEXCEPT -> const view_type&
 {
     return decoder.literal();
 }
 
-template <typename CharT>
-auto basic_reader<CharT>::tail() const BOOST_NOEXCEPT -> const view_type&
+template <typename CharT, std::size_t N>
+auto basic_reader<CharT, N>::tail() const BOOST_NOEXCEPT -> const view_type&
 {
     return decoder.tail();
 }
 
-template <typename CharT>
+template <typename CharT, std::size_t N>
 template <typename ReturnType>
-ReturnType basic_reader<CharT>::bool_value() const
+ReturnType basic_reader<CharT, N>::bool_value() const
 {
     switch (decoder.code())
     {
@@ -249,9 +332,9 @@ ReturnType basic_reader<CharT>::bool_value() const
     }
 }
 
-template <typename CharT>
+template <typename CharT, std::size_t N>
 template <typename ReturnType>
-ReturnType basic_reader<CharT>::integer_value() const
+ReturnType basic_reader<CharT, N>::integer_value() const
 {
     switch (decoder.code())
     {
@@ -275,9 +358,9 @@ ReturnType basic_reader<CharT>::integer_value() const
     }
 }
 
-template <typename CharT>
+template <typename CharT, std::size_t N>
 template <typename ReturnType>
-ReturnType basic_reader<CharT>::real_value() const
+ReturnType basic_reader<CharT, N>::real_value() const
 {
     switch (decoder.code())
     {
@@ -294,9 +377,9 @@ ReturnType basic_reader<CharT>::real_value() const
     }
 }
 
-template <typename CharT>
+template <typename CharT, std::size_t N>
 template <typename ReturnType>
-ReturnType basic_reader<CharT>::string_value() const
+ReturnType basic_reader<CharT, N>::string_value() const
 {
     switch (decoder.code())
     {
@@ -313,27 +396,27 @@ ReturnType basic_reader<CharT>::string_value() const
 // reader::frame
 //-----------------------------------------------------------------------------
 
-template <typename CharT>
-basic_reader<CharT>::frame::frame(token::detail::code::value scope)
+template <typename CharT, std::size_t N>
+basic_reader<CharT, N>::frame::frame(token::detail::code::value scope)
     : scope(scope),
       counter(0)
 {
 }
 
-template <typename CharT>
-bool basic_reader<CharT>::frame::is_array() const
+template <typename CharT, std::size_t N>
+bool basic_reader<CharT, N>::frame::is_array() const
 {
     return scope == token::detail::code::end_array;
 }
 
-template <typename CharT>
-bool basic_reader<CharT>::frame::is_object() const
+template <typename CharT, std::size_t N>
+bool basic_reader<CharT, N>::frame::is_object() const
 {
     return scope == token::detail::code::end_object;
 }
 
-template <typename CharT>
-token::detail::code::value basic_reader<CharT>::frame::next(decoder_type& decoder)
+template <typename CharT, std::size_t N>
+token::detail::code::value basic_reader<CharT, N>::frame::next(decoder_type& decoder)
 {
     decoder.next();
 
@@ -353,8 +436,8 @@ token::detail::code::value basic_reader<CharT>::frame::next(decoder_type& decode
     }
 }
 
-template <typename CharT>
-token::detail::code::value basic_reader<CharT>::frame::check_outer(decoder_type& decoder)
+template <typename CharT, std::size_t N>
+token::detail::code::value basic_reader<CharT, N>::frame::check_outer(decoder_type& decoder)
 {
     // RFC 7159, section 2
     //
@@ -384,8 +467,8 @@ token::detail::code::value basic_reader<CharT>::frame::check_outer(decoder_type&
     }
 }
 
-template <typename CharT>
-token::detail::code::value basic_reader<CharT>::frame::check_array(decoder_type& decoder)
+template <typename CharT, std::size_t N>
+token::detail::code::value basic_reader<CharT, N>::frame::check_array(decoder_type& decoder)
 {
     // RFC 7159, section 5
     //
@@ -440,8 +523,8 @@ token::detail::code::value basic_reader<CharT>::frame::check_array(decoder_type&
     return token::detail::code::error_unexpected_token;
 }
 
-template <typename CharT>
-token::detail::code::value basic_reader<CharT>::frame::check_object(decoder_type& decoder)
+template <typename CharT, std::size_t N>
+token::detail::code::value basic_reader<CharT, N>::frame::check_object(decoder_type& decoder)
 {
     // RFC 7159, section 4
     //
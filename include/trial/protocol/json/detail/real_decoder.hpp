@@ -0,0 +1,872 @@
+#ifndef TRIAL_PROTOCOL_JSON_DETAIL_REAL_DECODER_HPP
+#define TRIAL_PROTOCOL_JSON_DETAIL_REAL_DECODER_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+// Locale-independent and correctly rounded conversion of JSON numbers into
+// floating-point numbers.
+//
+// The number is first reduced to a decimal mantissa of at most 19 digits and
+// a decimal exponent. Conversion then tries, in order:
+//
+//   1. Clinger's fast path when both mantissa and power of ten are exact.
+//   2. The Eisel-Lemire algorithm using a table of 128-bit powers of five.
+//   3. Arbitrary-precision decimal shifting when the above are inconclusive.
+//
+// The input must be a number token validated by the decoder. The input is
+// never read beyond the end of the view.
+
+#include <cassert>
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <trial/protocol/core/detail/string_view.hpp>
+#include <trial/protocol/core/char_traits.hpp>
+#include <trial/protocol/json/detail/power_of_five.hpp>
+#include <trial/protocol/json/detail/traits.hpp>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+# include <intrin.h>
+#endif
+
+namespace trial
+{
+namespace protocol
+{
+namespace json
+{
+namespace detail
+{
+namespace real
+{
+
+//-----------------------------------------------------------------------------
+// 128-bit multiplication
+//-----------------------------------------------------------------------------
+
+struct uint128
+{
+    std::uint64_t low;
+    std::uint64_t high;
+};
+
+inline uint128 full_multiply(std::uint64_t lhs, std::uint64_t rhs)
+{
+    uint128 result;
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 native_type;
+    const native_type product = static_cast<native_type>(lhs) * rhs;
+    result.low = std::uint64_t(product);
+    result.high = std::uint64_t(product >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    result.low = _umul128(lhs, rhs, &result.high);
+#else
+    const std::uint64_t lhs_low = lhs & 0xFFFFFFFF;
+    const std::uint64_t lhs_high = lhs >> 32;
+    const std::uint64_t rhs_low = rhs & 0xFFFFFFFF;
+    const std::uint64_t rhs_high = rhs >> 32;
+    const std::uint64_t low_low = lhs_low * rhs_low;
+    const std::uint64_t high_low = lhs_high * rhs_low;
+    const std::uint64_t low_high = lhs_low * rhs_high;
+    const std::uint64_t high_high = lhs_high * rhs_high;
+    const std::uint64_t middle = (low_low >> 32) + (high_low & 0xFFFFFFFF) + low_high;
+    result.low = (middle << 32) | (low_low & 0xFFFFFFFF);
+    result.high = high_high + (high_low >> 32) + (middle >> 32);
+#endif
+    return result;
+}
+
+inline int leading_zeros(std::uint64_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_clzll(value);
+#else
+    int result = 0;
+    while ((value & (std::uint64_t(1) << 63)) == 0)
+    {
+        value <<= 1;
+        ++result;
+    }
+    return result;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+// Decimal number reduced to 19 significant digits
+//-----------------------------------------------------------------------------
+
+struct decimal_number
+{
+    static const int max_digits = 19;
+    // Exponents beyond this limit are saturated
+    static const int max_exponent = 100000;
+
+    std::uint64_t mantissa = 0;
+    int exponent = 0;
+    bool negative = false;
+    // Non-zero digits were discarded from the mantissa
+    bool truncated = false;
+
+    template <typename CharT>
+    explicit decimal_number(const core::detail::basic_string_view<CharT, core::char_traits<CharT>>& view)
+    {
+        auto it = view.begin();
+        const auto end = view.end();
+
+        if ((it != end) && (*it == traits<CharT>::alpha_minus))
+        {
+            negative = true;
+            ++it;
+        }
+        int digits = 0;
+        for (; (it != end) && traits<CharT>::is_digit(*it); ++it)
+        {
+            append(digits, *it - traits<CharT>::alpha_0, false);
+        }
+        if ((it != end) && (*it == traits<CharT>::alpha_dot))
+        {
+            ++it;
+            for (; (it != end) && traits<CharT>::is_digit(*it); ++it)
+            {
+                append(digits, *it - traits<CharT>::alpha_0, true);
+            }
+        }
+        if ((it != end) && ((*it == traits<CharT>::alpha_e) || (*it == traits<CharT>::alpha_E)))
+        {
+            ++it;
+            bool negative_exponent = false;
+            if (it != end)
+            {
+                if (*it == traits<CharT>::alpha_minus)
+                {
+                    negative_exponent = true;
+                    ++it;
+                }
+                else if (*it == traits<CharT>::alpha_plus)
+                {
+                    ++it;
+                }
+            }
+            int value = 0;
+            for (; (it != end) && traits<CharT>::is_digit(*it); ++it)
+            {
+                if (value < max_exponent)
+                    value = value * 10 + (*it - traits<CharT>::alpha_0);
+            }
+            exponent += negative_exponent ? -value : value;
+        }
+    }
+
+private:
+    void append(int& digits, int digit, bool is_fraction)
+    {
+        if ((mantissa == 0) && (digit == 0))
+        {
+            // Leading zero
+            if (is_fraction)
+                --exponent;
+            return;
+        }
+        if (digits < max_digits)
+        {
+            mantissa = mantissa * 10 + std::uint64_t(digit);
+            ++digits;
+            if (is_fraction)
+                --exponent;
+        }
+        else
+        {
+            if (digit != 0)
+                truncated = true;
+            if (!is_fraction)
+                ++exponent;
+        }
+    }
+};
+
+//-----------------------------------------------------------------------------
+// Clinger's fast path
+//-----------------------------------------------------------------------------
+
+template <typename T>
+struct exact_powers
+{
+    // Largest exponent such that 10^exponent is exactly representable
+    static const int max_exponent = (std::numeric_limits<T>::digits >= 113) ? 48
+        : (std::numeric_limits<T>::digits >= 64) ? 27
+        : (std::numeric_limits<T>::digits >= 53) ? 22
+        : 10;
+
+    static T value(int exponent)
+    {
+        static const T table[] = {
+            T(1e0L), T(1e1L), T(1e2L), T(1e3L), T(1e4L), T(1e5L), T(1e6L), T(1e7L), T(1e8L), T(1e9L),
+            T(1e10L), T(1e11L), T(1e12L), T(1e13L), T(1e14L), T(1e15L), T(1e16L), T(1e17L), T(1e18L), T(1e19L),
+            T(1e20L), T(1e21L), T(1e22L), T(1e23L), T(1e24L), T(1e25L), T(1e26L), T(1e27L), T(1e28L), T(1e29L),
+            T(1e30L), T(1e31L), T(1e32L), T(1e33L), T(1e34L), T(1e35L), T(1e36L), T(1e37L), T(1e38L), T(1e39L),
+            T(1e40L), T(1e41L), T(1e42L), T(1e43L), T(1e44L), T(1e45L), T(1e46L), T(1e47L), T(1e48L)
+        };
+        return table[exponent];
+    }
+};
+
+template <typename T>
+bool clinger(const decimal_number& number, T& result)
+{
+#if defined(FLT_EVAL_METHOD) && (FLT_EVAL_METHOD != 0) && (FLT_EVAL_METHOD != 1)
+    // Intermediate results may be double-rounded
+    if (!std::is_same<T, long double>::value)
+        return false;
+#endif
+    if (!std::numeric_limits<T>::is_iec559 || number.truncated)
+        return false;
+    const int mantissa_digits = (std::numeric_limits<T>::digits < 64) ? std::numeric_limits<T>::digits : 64;
+    if ((mantissa_digits < 64) && (number.mantissa > (std::uint64_t(1) << (mantissa_digits % 64))))
+        return false;
+    if ((number.exponent < -exact_powers<T>::max_exponent) ||
+        (number.exponent > exact_powers<T>::max_exponent))
+        return false;
+
+    result = T(number.mantissa);
+    if (number.exponent < 0)
+        result /= exact_powers<T>::value(-number.exponent);
+    else
+        result *= exact_powers<T>::value(number.exponent);
+    if (number.negative)
+        result = -result;
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Eisel-Lemire algorithm
+//-----------------------------------------------------------------------------
+
+template <typename T>
+struct binary_format;
+
+template <>
+struct binary_format<double>
+{
+    using bits_type = std::uint64_t;
+    static const int mantissa_explicit_bits = 52;
+    static const int minimum_exponent = -1023;
+    static const int infinite_power = 0x7FF;
+    static const int sign_index = 63;
+    static const int smallest_power_of_ten = -342;
+    static const int largest_power_of_ten = 308;
+    static const int min_exponent_round_to_even = -4;
+    static const int max_exponent_round_to_even = 23;
+};
+
+template <>
+struct binary_format<float>
+{
+    using bits_type = std::uint32_t;
+    static const int mantissa_explicit_bits = 23;
+    static const int minimum_exponent = -127;
+    static const int infinite_power = 0xFF;
+    static const int sign_index = 31;
+    static const int smallest_power_of_ten = -65;
+    static const int largest_power_of_ten = 38;
+    static const int min_exponent_round_to_even = -17;
+    static const int max_exponent_round_to_even = 10;
+};
+
+// Binary mantissa (without implicit bit) and biased binary exponent
+struct adjusted_mantissa
+{
+    std::uint64_t mantissa;
+    int power2;
+
+    bool operator==(const adjusted_mantissa& other) const
+    {
+        return (mantissa == other.mantissa) && (power2 == other.power2);
+    }
+};
+
+// Approximation of w * 5^q with at least Precision correct bits
+template <int Precision>
+uint128 product_approximation(int q, std::uint64_t w)
+{
+    const int index = 2 * (q - power_of_five::smallest_power);
+    const std::uint64_t *table = power_of_five::table();
+    const std::uint64_t precision_mask = (Precision < 64)
+        ? (std::numeric_limits<std::uint64_t>::max() >> Precision)
+        : std::numeric_limits<std::uint64_t>::max();
+    uint128 first = full_multiply(w, table[index]);
+    if ((first.high & precision_mask) == precision_mask)
+    {
+        // Lower bits are inconclusive so extend with the next 64 bits
+        const uint128 second = full_multiply(w, table[index + 1]);
+        first.low += second.high;
+        if (second.high > first.low)
+        {
+            ++first.high;
+        }
+    }
+    return first;
+}
+
+// Binary exponent of 10^q rounded down
+inline int binary_power(int q)
+{
+    return (((152170 + 65536) * q) >> 16) + 63;
+}
+
+template <typename T>
+adjusted_mantissa eisel_lemire(int q, std::uint64_t w)
+{
+    using format = binary_format<T>;
+    adjusted_mantissa answer;
+
+    if ((w == 0) || (q < format::smallest_power_of_ten))
+    {
+        answer.mantissa = 0;
+        answer.power2 = 0;
+        return answer;
+    }
+    if (q > format::largest_power_of_ten)
+    {
+        answer.mantissa = 0;
+        answer.power2 = format::infinite_power;
+        return answer;
+    }
+
+    const int lz = leading_zeros(w);
+    w <<= lz;
+    const uint128 product = product_approximation<format::mantissa_explicit_bits + 3>(q, w);
+    const int upperbit = int(product.high >> 63);
+    const int shift = upperbit + 64 - format::mantissa_explicit_bits - 3;
+
+    answer.mantissa = product.high >> shift;
+    answer.power2 = binary_power(q) + upperbit - lz - format::minimum_exponent;
+
+    if (answer.power2 <= 0)
+    {
+        // Subnormal
+        if (-answer.power2 + 1 >= 64)
+        {
+            answer.mantissa = 0;
+            answer.power2 = 0;
+            return answer;
+        }
+        answer.mantissa >>= -answer.power2 + 1;
+        answer.mantissa += (answer.mantissa & 1);
+        answer.mantissa >>= 1;
+        answer.power2 = (answer.mantissa < (std::uint64_t(1) << format::mantissa_explicit_bits)) ? 0 : 1;
+        return answer;
+    }
+
+    // Exactly halfway between two floating-point numbers is only possible
+    // within a small range of exponents. Round to even.
+    if ((product.low <= 1) &&
+        (q >= format::min_exponent_round_to_even) &&
+        (q <= format::max_exponent_round_to_even) &&
+        ((answer.mantissa & 3) == 1))
+    {
+        if ((answer.mantissa << shift) == product.high)
+        {
+            answer.mantissa &= ~std::uint64_t(1);
+        }
+    }
+
+    answer.mantissa += (answer.mantissa & 1);
+    answer.mantissa >>= 1;
+    if (answer.mantissa >= (std::uint64_t(2) << format::mantissa_explicit_bits))
+    {
+        answer.mantissa = (std::uint64_t(1) << format::mantissa_explicit_bits);
+        ++answer.power2;
+    }
+    answer.mantissa &= ~(std::uint64_t(1) << format::mantissa_explicit_bits);
+    if (answer.power2 >= format::infinite_power)
+    {
+        answer.mantissa = 0;
+        answer.power2 = format::infinite_power;
+    }
+    return answer;
+}
+
+// Eisel-Lemire algorithm for 64-bit mantissas, such as the x87 extended
+// precision format.
+//
+// The full 192-bit product is used, and the conversion is rejected if the
+// truncation error of the power of five could affect the rounding.
+inline bool eisel_lemire_extended(int q, std::uint64_t w, std::uint64_t& mantissa, int& exponent)
+{
+    assert(w != 0);
+    if ((q < power_of_five::smallest_power) || (q > power_of_five::largest_power))
+        return false;
+
+    const int lz = leading_zeros(w);
+    w <<= lz;
+    const int index = 2 * (q - power_of_five::smallest_power);
+    const std::uint64_t *table = power_of_five::table();
+    const uint128 upper = full_multiply(w, table[index]);
+    const uint128 lower = full_multiply(w, table[index + 1]);
+
+    std::uint64_t low = lower.low;
+    std::uint64_t middle = lower.high + upper.low;
+    std::uint64_t high = upper.high + ((middle < upper.low) ? 1 : 0);
+
+    const int upperbit = int(high >> 63);
+    if (upperbit == 0)
+    {
+        high = (high << 1) | (middle >> 63);
+        middle = (middle << 1) | (low >> 63);
+        low <<= 1;
+    }
+    // The truncation error is below 2^65 in units of the low word, so the
+    // discarded bits are only reliable away from zero and from halfway.
+    if ((middle + 2 < 4) || (middle - 0x7FFFFFFFFFFFFFFDu < 5))
+        return false;
+
+    mantissa = high;
+    exponent = binary_power(q) - 63 - lz + upperbit;
+    if ((middle >> 63) != 0)
+    {
+        ++mantissa;
+        if (mantissa == 0)
+        {
+            mantissa = std::uint64_t(1) << 63;
+            ++exponent;
+        }
+    }
+    return true;
+}
+
+template <typename T>
+T assemble(const adjusted_mantissa& answer, bool negative)
+{
+    using format = binary_format<T>;
+    using bits_type = typename format::bits_type;
+    static_assert(sizeof(T) == sizeof(bits_type), "Unexpected floating-point layout");
+
+    bits_type bits = bits_type(answer.mantissa);
+    bits |= bits_type(answer.power2) << format::mantissa_explicit_bits;
+    if (negative)
+        bits |= bits_type(1) << format::sign_index;
+    T result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+//-----------------------------------------------------------------------------
+// Arbitrary-precision decimal
+//-----------------------------------------------------------------------------
+
+// Decimal number 0.digits * 10^point that can be shifted by powers of two.
+class big_decimal
+{
+public:
+    static const int max_digits = 800;
+
+    template <typename CharT>
+    explicit big_decimal(const core::detail::basic_string_view<CharT, core::char_traits<CharT>>& view)
+        : count(0),
+          point(0),
+          negative(false),
+          truncated(false)
+    {
+        auto it = view.begin();
+        const auto end = view.end();
+
+        if ((it != end) && (*it == traits<CharT>::alpha_minus))
+        {
+            negative = true;
+            ++it;
+        }
+        int significant = 0;
+        bool seen_dot = false;
+        for (; it != end; ++it)
+        {
+            if (*it == traits<CharT>::alpha_dot)
+            {
+                point = significant;
+                seen_dot = true;
+                continue;
+            }
+            if (!traits<CharT>::is_digit(*it))
+                break;
+            const int digit = *it - traits<CharT>::alpha_0;
+            if ((digit == 0) && (significant == 0))
+            {
+                // Leading zero
+                if (seen_dot)
+                    --point;
+                continue;
+            }
+            ++significant;
+            if (count < max_digits)
+                digits[count++] = std::uint8_t(digit);
+            else if (digit != 0)
+                truncated = true;
+        }
+        if (!seen_dot)
+        {
+            point = significant;
+        }
+        if ((it != end) && ((*it == traits<CharT>::alpha_e) || (*it == traits<CharT>::alpha_E)))
+        {
+            ++it;
+            bool negative_exponent = false;
+            if (it != end)
+            {
+                if (*it == traits<CharT>::alpha_minus)
+                {
+                    negative_exponent = true;
+                    ++it;
+                }
+                else if (*it == traits<CharT>::alpha_plus)
+                {
+                    ++it;
+                }
+            }
+            int value = 0;
+            for (; (it != end) && traits<CharT>::is_digit(*it); ++it)
+            {
+                if (value < decimal_number::max_exponent)
+                    value = value * 10 + (*it - traits<CharT>::alpha_0);
+            }
+            point += negative_exponent ? -value : value;
+        }
+        trim();
+    }
+
+    template <typename T>
+    T convert()
+    {
+        using limits = std::numeric_limits<T>;
+        const int mantissa_bits = limits::digits - 1;
+        // Smallest exponent of normalized numbers minus one
+        const int bias = limits::min_exponent - 2;
+
+        if (count == 0)
+            return signed_value(T(0));
+        if (point > limits::max_exponent10 + 2)
+            return signed_value(limits::infinity());
+        if (point < limits::min_exponent10 - limits::digits10 - 20)
+            return signed_value(T(0));
+
+        // Scale into [0.5, 1) while keeping track of the binary exponent
+        int exponent = 0;
+        while (point > 0)
+        {
+            const int n = shift_amount(point);
+            shift(-n);
+            exponent += n;
+        }
+        while ((point < 0) || ((point == 0) && (digits[0] < 5)))
+        {
+            const int n = shift_amount(-point);
+            shift(n);
+            exponent -= n;
+        }
+        // Range is [0.5, 1) but floating-point numbers are in [1, 2)
+        --exponent;
+
+        if (exponent < bias + 1)
+        {
+            // Subnormal
+            const int n = bias + 1 - exponent;
+            shift(-n);
+            exponent += n;
+        }
+        if (exponent >= limits::max_exponent)
+            return signed_value(limits::infinity());
+
+        // Extract mantissa including the implicit bit. Integers of this size
+        // are exactly representable so the arithmetic is done in T.
+        shift(1 + mantissa_bits);
+        T mantissa = T(0);
+        int i = 0;
+        for (; (i < point) && (i < count); ++i)
+        {
+            mantissa = mantissa * T(10) + T(digits[i]);
+        }
+        for (; i < point; ++i)
+        {
+            mantissa *= T(10);
+        }
+        if (should_round_up(point))
+        {
+            mantissa += T(1);
+            if (mantissa == std::ldexp(T(1), mantissa_bits + 1))
+            {
+                // Rounding carried into a new bit
+                mantissa = std::ldexp(T(1), mantissa_bits);
+                ++exponent;
+                if (exponent >= limits::max_exponent)
+                    return signed_value(limits::infinity());
+            }
+        }
+        return signed_value(std::ldexp(mantissa, exponent - mantissa_bits));
+    }
+
+private:
+    static const int max_shift = 60;
+
+    template <typename T>
+    T signed_value(T value) const
+    {
+        return negative ? -value : value;
+    }
+
+    // Number of bits to shift by to move the decimal point by the given
+    // number of decimal digits without overshooting
+    static int shift_amount(int decimal_digits)
+    {
+        static const int table[] = { 1, 3, 6, 9, 13, 16, 19, 23, 26 };
+        return (decimal_digits < int(sizeof(table) / sizeof(table[0])))
+            ? table[decimal_digits]
+            : 27;
+    }
+
+    void shift(int amount)
+    {
+        if (count == 0)
+            return;
+        while (amount > max_shift)
+        {
+            left_shift(max_shift);
+            amount -= max_shift;
+        }
+        while (amount < -max_shift)
+        {
+            right_shift(max_shift);
+            amount += max_shift;
+        }
+        if (amount > 0)
+            left_shift(amount);
+        else if (amount < 0)
+            right_shift(-amount);
+    }
+
+    void left_shift(int amount)
+    {
+        // Multiply from the least significant digit and store the result in
+        // reverse order
+        std::uint8_t reversed[max_digits + 20];
+        int size = 0;
+        std::uint64_t carry = 0;
+        for (int r = count - 1; r >= 0; --r)
+        {
+            carry += std::uint64_t(digits[r]) << amount;
+            const std::uint64_t quotient = carry / 10;
+            reversed[size++] = std::uint8_t(carry - 10 * quotient);
+            carry = quotient;
+        }
+        while (carry > 0)
+        {
+            const std::uint64_t quotient = carry / 10;
+            reversed[size++] = std::uint8_t(carry - 10 * quotient);
+            carry = quotient;
+        }
+        point += size - count;
+        const int keep = (size < max_digits) ? size : max_digits;
+        for (int i = 0; i < keep; ++i)
+        {
+            digits[i] = reversed[size - 1 - i];
+        }
+        for (int i = keep; i < size; ++i)
+        {
+            if (reversed[size - 1 - i] != 0)
+                truncated = true;
+        }
+        count = keep;
+        trim();
+    }
+
+    void right_shift(int amount)
+    {
+        int r = 0;
+        int w = 0;
+        std::uint64_t n = 0;
+        for (; (n >> amount) == 0; ++r)
+        {
+            if (r >= count)
+            {
+                if (n == 0)
+                {
+                    count = 0;
+                    point = 0;
+                    return;
+                }
+                while ((n >> amount) == 0)
+                {
+                    n *= 10;
+                    ++r;
+                }
+                break;
+            }
+            n = n * 10 + digits[r];
+        }
+        point -= r - 1;
+
+        const std::uint64_t mask = (std::uint64_t(1) << amount) - 1;
+        for (; r < count; ++r)
+        {
+            digits[w++] = std::uint8_t(n >> amount);
+            n &= mask;
+            n = n * 10 + digits[r];
+        }
+        while (n > 0)
+        {
+            const std::uint8_t digit = std::uint8_t(n >> amount);
+            n &= mask;
+            if (w < max_digits)
+                digits[w++] = digit;
+            else if (digit > 0)
+                truncated = true;
+            n *= 10;
+        }
+        count = w;
+        trim();
+    }
+
+    bool should_round_up(int position) const
+    {
+        if ((position < 0) || (position >= count))
+            return false;
+        if ((digits[position] == 5) && (position + 1 == count))
+        {
+            // Exactly halfway unless digits were discarded
+            if (truncated)
+                return true;
+            return (position > 0) && (digits[position - 1] % 2 == 1);
+        }
+        return digits[position] >= 5;
+    }
+
+    void trim()
+    {
+        while ((count > 0) && (digits[count - 1] == 0))
+            --count;
+        if (count == 0)
+            point = 0;
+    }
+
+    std::uint8_t digits[max_digits];
+    int count;
+    int point;
+    bool negative;
+    bool truncated;
+};
+
+//-----------------------------------------------------------------------------
+// Conversion
+//-----------------------------------------------------------------------------
+
+template <typename T, typename Enable = void>
+struct converter;
+
+// IEEE 754 binary32 and binary64
+
+template <typename T>
+struct converter<T,
+                 typename std::enable_if<std::is_same<T, float>::value ||
+                                         std::is_same<T, double>::value>::type>
+{
+    template <typename CharT>
+    static T decode(const core::detail::basic_string_view<CharT, core::char_traits<CharT>>& view)
+    {
+        const decimal_number number(view);
+        if (number.mantissa == 0)
+            return number.negative ? -T(0) : T(0);
+
+        T result;
+        if (clinger(number, result))
+            return result;
+
+        const adjusted_mantissa answer = eisel_lemire<T>(number.exponent, number.mantissa);
+        if (number.truncated)
+        {
+            // True value lies between mantissa and mantissa + 1
+            if (!(answer == eisel_lemire<T>(number.exponent, number.mantissa + 1)))
+            {
+                return big_decimal(view).template convert<T>();
+            }
+        }
+        return assemble<T>(answer, number.negative);
+    }
+};
+
+// Extended precision
+
+template <typename T>
+struct converter<T,
+                 typename std::enable_if<std::is_same<T, long double>::value>::type>
+{
+    template <typename CharT>
+    static T decode(const core::detail::basic_string_view<CharT, core::char_traits<CharT>>& view)
+    {
+        if (std::numeric_limits<long double>::digits == std::numeric_limits<double>::digits)
+        {
+            return converter<double>::decode(view);
+        }
+
+        const decimal_number number(view);
+        if (number.mantissa == 0)
+            return number.negative ? -T(0) : T(0);
+
+        T result;
+        if (clinger(number, result))
+            return result;
+
+        if (std::numeric_limits<long double>::digits == 64)
+        {
+            std::uint64_t mantissa;
+            int exponent;
+            if (eisel_lemire_extended(number.exponent, number.mantissa, mantissa, exponent))
+            {
+                bool is_exact = !number.truncated;
+                if (!is_exact)
+                {
+                    // True value lies between mantissa and mantissa + 1
+                    std::uint64_t other_mantissa;
+                    int other_exponent;
+                    is_exact = eisel_lemire_extended(number.exponent, number.mantissa + 1, other_mantissa, other_exponent) &&
+                        (mantissa == other_mantissa) &&
+                        (exponent == other_exponent);
+                }
+                if (is_exact)
+                {
+                    result = std::ldexp(static_cast<T>(mantissa), exponent);
+                    return number.negative ? -result : result;
+                }
+            }
+        }
+
+        return big_decimal(view).template convert<T>();
+    }
+};
+
+} // namespace real
+
+template <typename CharT, typename T>
+struct real_decoder
+{
+    using view_type = core::detail::basic_string_view<CharT, core::char_traits<CharT>>;
+
+    static T decode(const view_type& view)
+    {
+        return real::converter<T>::decode(view);
+    }
+};
+
+} // namespace detail
+} // namespace json
+} // namespace protocol
+} // namespace trial
+
+#endif // TRIAL_PROTOCOL_JSON_DETAIL_REAL_DECODER_HPP
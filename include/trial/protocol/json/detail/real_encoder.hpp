@@ -0,0 +1,563 @@
+#ifndef TRIAL_PROTOCOL_JSON_DETAIL_REAL_ENCODER_HPP
+#define TRIAL_PROTOCOL_JSON_DETAIL_REAL_ENCODER_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+// Round-trip formatting of floating-point numbers.
+//
+// Digits are generated with the Grisu2 algorithm from
+//
+//   F. Loitsch, "Printing Floating-Point Numbers Quickly and Accurately with
+//   Integers", PLDI 2010
+//
+// using the boundary and rounding refinements by M. Andrysco, R. Jhala, and
+// S. Lerner. The result always converts back to the same value, and is the
+// shortest such representation for all but a small fraction of inputs.
+
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <sstream>
+#include <iomanip>
+#include <locale>
+#include <type_traits>
+#include <trial/protocol/json/detail/real_decoder.hpp>
+#include <trial/protocol/json/detail/traits.hpp>
+
+namespace trial
+{
+namespace protocol
+{
+namespace json
+{
+namespace detail
+{
+namespace real
+{
+
+//-----------------------------------------------------------------------------
+// Floating-point number with a 64-bit significand and a binary exponent
+//-----------------------------------------------------------------------------
+
+struct diy_fp
+{
+    static const int significand_size = 64;
+
+    diy_fp(std::uint64_t f, int e) : f(f), e(e) {}
+
+    // Requires x.e == y.e and x.f >= y.f
+    static diy_fp subtract(const diy_fp& x, const diy_fp& y)
+    {
+        assert(x.e == y.e);
+        assert(x.f >= y.f);
+        return diy_fp(x.f - y.f, x.e);
+    }
+
+    // Upper half of the 128-bit product, rounded half up
+    static diy_fp multiply(const diy_fp& x, const diy_fp& y)
+    {
+        const uint128 product = full_multiply(x.f, y.f);
+        return diy_fp(product.high + (product.low >> 63), x.e + y.e + significand_size);
+    }
+
+    static diy_fp normalize(diy_fp x)
+    {
+        assert(x.f != 0);
+        const int shift = leading_zeros(x.f);
+        return diy_fp(x.f << shift, x.e - shift);
+    }
+
+    static diy_fp normalize_to(const diy_fp& x, int target_exponent)
+    {
+        const int delta = x.e - target_exponent;
+        assert(delta >= 0);
+        assert(((x.f << delta) >> delta) == x.f);
+        return diy_fp(x.f << delta, target_exponent);
+    }
+
+    std::uint64_t f;
+    int e;
+};
+
+// Normalized value with the normalized midpoints to its neighbours. The
+// boundaries share the exponent of the upper boundary.
+struct boundaries
+{
+    diy_fp w;
+    diy_fp minus;
+    diy_fp plus;
+};
+
+template <typename T>
+boundaries compute_boundaries(T value)
+{
+    static_assert(std::numeric_limits<T>::is_iec559, "T must be an IEEE-754 binary format");
+    assert(std::isfinite(value));
+    assert(value > 0);
+
+    using format = binary_format<T>;
+    using bits_type = typename format::bits_type;
+    const int precision = format::mantissa_explicit_bits + 1;
+    const int bias = std::numeric_limits<T>::max_exponent - 1 + (precision - 1);
+    const int min_exponent = 1 - bias;
+    const bits_type hidden_bit = bits_type(1) << (precision - 1);
+
+    bits_type bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    const std::uint64_t biased_exponent = bits >> (precision - 1);
+    const std::uint64_t fraction = bits & (hidden_bit - 1);
+
+    const diy_fp v = (biased_exponent == 0)
+        ? diy_fp(fraction, min_exponent)
+        : diy_fp(fraction + hidden_bit, int(biased_exponent) - bias);
+
+    // The lower neighbour is closer when the fraction is zero, except for the
+    // smallest normal number whose lower neighbour is a subnormal
+    const bool lower_boundary_is_closer = (fraction == 0) && (biased_exponent > 1);
+    const diy_fp m_plus(2 * v.f + 1, v.e - 1);
+    const diy_fp m_minus = lower_boundary_is_closer
+        ? diy_fp(4 * v.f - 1, v.e - 2)
+        : diy_fp(2 * v.f - 1, v.e - 1);
+
+    const diy_fp w_plus = diy_fp::normalize(m_plus);
+    return { diy_fp::normalize(v), diy_fp::normalize_to(m_minus, w_plus.e), w_plus };
+}
+
+//-----------------------------------------------------------------------------
+// Cached powers of ten
+//-----------------------------------------------------------------------------
+
+// Scaled products are kept within [2^alpha, 2^gamma) so the integral part
+// fits into 32 bits
+struct cached_power
+{
+    static const int alpha = -60;
+    static const int gamma = -32;
+    static const int smallest_power = -300;
+    static const int power_step = 8;
+
+    std::uint64_t f;
+    int e;
+    int k;
+
+    // Returns c = 10^k with alpha <= e_c + e + 64 <= gamma
+    static cached_power lookup(int e)
+    {
+        // Normalized 64-bit approximations of 10^k for k = -300, -292, ..., 324
+        static const cached_power table[] = {
+            { UINT64_C(0xab70fe17c79ac6ca), -1060, -300 },
+            { UINT64_C(0xff77b1fcbebcdc4f), -1034, -292 },
+            { UINT64_C(0xbe5691ef416bd60c), -1007, -284 },
+            { UINT64_C(0x8dd01fad907ffc3c), -980, -276 },
+            { UINT64_C(0xd3515c2831559a83), -954, -268 },
+            { UINT64_C(0x9d71ac8fada6c9b5), -927, -260 },
+            { UINT64_C(0xea9c227723ee8bcb), -901, -252 },
+            { UINT64_C(0xaecc49914078536d), -874, -244 },
+            { UINT64_C(0x823c12795db6ce57), -847, -236 },
+            { UINT64_C(0xc21094364dfb5637), -821, -228 },
+            { UINT64_C(0x9096ea6f3848984f), -794, -220 },
+            { UINT64_C(0xd77485cb25823ac7), -768, -212 },
+            { UINT64_C(0xa086cfcd97bf97f4), -741, -204 },
+            { UINT64_C(0xef340a98172aace5), -715, -196 },
+            { UINT64_C(0xb23867fb2a35b28e), -688, -188 },
+            { UINT64_C(0x84c8d4dfd2c63f3b), -661, -180 },
+            { UINT64_C(0xc5dd44271ad3cdba), -635, -172 },
+            { UINT64_C(0x936b9fcebb25c996), -608, -164 },
+            { UINT64_C(0xdbac6c247d62a584), -582, -156 },
+            { UINT64_C(0xa3ab66580d5fdaf6), -555, -148 },
+            { UINT64_C(0xf3e2f893dec3f126), -529, -140 },
+            { UINT64_C(0xb5b5ada8aaff80b8), -502, -132 },
+            { UINT64_C(0x87625f056c7c4a8b), -475, -124 },
+            { UINT64_C(0xc9bcff6034c13053), -449, -116 },
+            { UINT64_C(0x964e858c91ba2655), -422, -108 },
+            { UINT64_C(0xdff9772470297ebd), -396, -100 },
+            { UINT64_C(0xa6dfbd9fb8e5b88f), -369, -92 },
+            { UINT64_C(0xf8a95fcf88747d94), -343, -84 },
+            { UINT64_C(0xb94470938fa89bcf), -316, -76 },
+            { UINT64_C(0x8a08f0f8bf0f156b), -289, -68 },
+            { UINT64_C(0xcdb02555653131b6), -263, -60 },
+            { UINT64_C(0x993fe2c6d07b7fac), -236, -52 },
+            { UINT64_C(0xe45c10c42a2b3b06), -210, -44 },
+            { UINT64_C(0xaa242499697392d3), -183, -36 },
+            { UINT64_C(0xfd87b5f28300ca0e), -157, -28 },
+            { UINT64_C(0xbce5086492111aeb), -130, -20 },
+            { UINT64_C(0x8cbccc096f5088cc), -103, -12 },
+            { UINT64_C(0xd1b71758e219652c), -77, -4 },
+            { UINT64_C(0x9c40000000000000), -50, 4 },
+            { UINT64_C(0xe8d4a51000000000), -24, 12 },
+            { UINT64_C(0xad78ebc5ac620000), 3, 20 },
+            { UINT64_C(0x813f3978f8940984), 30, 28 },
+            { UINT64_C(0xc097ce7bc90715b3), 56, 36 },
+            { UINT64_C(0x8f7e32ce7bea5c70), 83, 44 },
+            { UINT64_C(0xd5d238a4abe98068), 109, 52 },
+            { UINT64_C(0x9f4f2726179a2245), 136, 60 },
+            { UINT64_C(0xed63a231d4c4fb27), 162, 68 },
+            { UINT64_C(0xb0de65388cc8ada8), 189, 76 },
+            { UINT64_C(0x83c7088e1aab65db), 216, 84 },
+            { UINT64_C(0xc45d1df942711d9a), 242, 92 },
+            { UINT64_C(0x924d692ca61be758), 269, 100 },
+            { UINT64_C(0xda01ee641a708dea), 295, 108 },
+            { UINT64_C(0xa26da3999aef774a), 322, 116 },
+            { UINT64_C(0xf209787bb47d6b85), 348, 124 },
+            { UINT64_C(0xb454e4a179dd1877), 375, 132 },
+            { UINT64_C(0x865b86925b9bc5c2), 402, 140 },
+            { UINT64_C(0xc83553c5c8965d3d), 428, 148 },
+            { UINT64_C(0x952ab45cfa97a0b3), 455, 156 },
+            { UINT64_C(0xde469fbd99a05fe3), 481, 164 },
+            { UINT64_C(0xa59bc234db398c25), 508, 172 },
+            { UINT64_C(0xf6c69a72a3989f5c), 534, 180 },
+            { UINT64_C(0xb7dcbf5354e9bece), 561, 188 },
+            { UINT64_C(0x88fcf317f22241e2), 588, 196 },
+            { UINT64_C(0xcc20ce9bd35c78a5), 614, 204 },
+            { UINT64_C(0x98165af37b2153df), 641, 212 },
+            { UINT64_C(0xe2a0b5dc971f303a), 667, 220 },
+            { UINT64_C(0xa8d9d1535ce3b396), 694, 228 },
+            { UINT64_C(0xfb9b7cd9a4a7443c), 720, 236 },
+            { UINT64_C(0xbb764c4ca7a44410), 747, 244 },
+            { UINT64_C(0x8bab8eefb6409c1a), 774, 252 },
+            { UINT64_C(0xd01fef10a657842c), 800, 260 },
+            { UINT64_C(0x9b10a4e5e9913129), 827, 268 },
+            { UINT64_C(0xe7109bfba19c0c9d), 853, 276 },
+            { UINT64_C(0xac2820d9623bf429), 880, 284 },
+            { UINT64_C(0x80444b5e7aa7cf85), 907, 292 },
+            { UINT64_C(0xbf21e44003acdd2d), 933, 300 },
+            { UINT64_C(0x8e679c2f5e44ff8f), 960, 308 },
+            { UINT64_C(0xd433179d9c8cb841), 986, 316 },
+            { UINT64_C(0x9e19db92b4e31ba9), 1013, 324 }
+        };
+
+        assert(e >= -1500);
+        assert(e <= 1500);
+        // k = ceil((alpha - e - 1) * log10(2)) using 78913 / 2^18 ~ log10(2)
+        const int f = alpha - e - 1;
+        const int k = (f * 78913) / (1 << 18) + int(f > 0);
+        const int index = (-smallest_power + k + (power_step - 1)) / power_step;
+        assert(index >= 0);
+        assert(std::size_t(index) < sizeof(table) / sizeof(table[0]));
+
+        const cached_power& result = table[index];
+        assert(alpha <= result.e + e + 64);
+        assert(gamma >= result.e + e + 64);
+        return result;
+    }
+};
+
+//-----------------------------------------------------------------------------
+// Grisu2
+//-----------------------------------------------------------------------------
+
+// Returns the number of decimal digits of n, and the largest power of ten
+// not exceeding n. Requires n > 0
+inline int find_largest_pow10(std::uint32_t n, std::uint32_t& pow10)
+{
+    static const std::uint32_t powers[] = {
+        1000000000, 100000000, 10000000, 1000000, 100000, 10000, 1000, 100, 10, 1
+    };
+    int digits = 10;
+    for (std::uint32_t power : powers)
+    {
+        if (n >= power)
+            break;
+        --digits;
+    }
+    assert(digits > 0);
+    pow10 = powers[10 - digits];
+    return digits;
+}
+
+// Moves the last digit closer to the exact value while remaining within the
+// rounding interval
+inline void grisu2_round(char *buffer, int length,
+                         std::uint64_t distance, std::uint64_t delta,
+                         std::uint64_t rest, std::uint64_t ten_k)
+{
+    assert(length >= 1);
+    assert(distance <= delta);
+    assert(rest <= delta);
+    assert(ten_k > 0);
+
+    while ((rest < distance) &&
+           (delta - rest >= ten_k) &&
+           ((rest + ten_k < distance) || (distance - rest > rest + ten_k - distance)))
+    {
+        assert(buffer[length - 1] != '0');
+        buffer[length - 1]--;
+        rest += ten_k;
+    }
+}
+
+// Generates the digits of M+ until the remainder falls within the rounding
+// interval [M-, M+]
+inline void grisu2_digit_gen(char *buffer, int& length, int& decimal_exponent,
+                             diy_fp m_minus, diy_fp w, diy_fp m_plus)
+{
+    assert(m_plus.e >= cached_power::alpha);
+    assert(m_plus.e <= cached_power::gamma);
+
+    std::uint64_t delta = diy_fp::subtract(m_plus, m_minus).f;
+    std::uint64_t distance = diy_fp::subtract(m_plus, w).f;
+
+    // Split M+ into an integral part p1 and a fractional part p2
+    const diy_fp one(std::uint64_t(1) << -m_plus.e, m_plus.e);
+
+    std::uint32_t p1 = std::uint32_t(m_plus.f >> -one.e);
+    std::uint64_t p2 = m_plus.f & (one.f - 1);
+
+    assert(p1 > 0);
+
+    std::uint32_t pow10;
+    int n = find_largest_pow10(p1, pow10);
+
+    while (n > 0)
+    {
+        const std::uint32_t digit = p1 / pow10;
+        p1 %= pow10;
+        assert(digit <= 9);
+        buffer[length++] = char('0' + digit);
+        --n;
+
+        const std::uint64_t rest = (std::uint64_t(p1) << -one.e) + p2;
+        if (rest <= delta)
+        {
+            decimal_exponent += n;
+            grisu2_round(buffer, length, distance, delta, rest, std::uint64_t(pow10) << -one.e);
+            return;
+        }
+        pow10 /= 10;
+    }
+
+    // The integral part is exhausted so continue with the fractional part
+    int m = 0;
+    for (;;)
+    {
+        assert(p2 <= std::numeric_limits<std::uint64_t>::max() / 10);
+        p2 *= 10;
+        const std::uint64_t digit = p2 >> -one.e;
+        p2 &= one.f - 1;
+        assert(digit <= 9);
+        buffer[length++] = char('0' + digit);
+        ++m;
+
+        delta *= 10;
+        distance *= 10;
+        if (p2 <= delta)
+            break;
+    }
+    decimal_exponent -= m;
+    grisu2_round(buffer, length, distance, delta, p2, one.f);
+}
+
+// Generates the decimal digits of value such that value = buffer * 10^exponent
+template <typename T>
+int grisu2(char *buffer, int& decimal_exponent, T value)
+{
+    const boundaries b = compute_boundaries(value);
+    const cached_power cached = cached_power::lookup(b.plus.e);
+    const diy_fp c_minus_k(cached.f, cached.e);
+
+    const diy_fp w = diy_fp::multiply(b.w, c_minus_k);
+    const diy_fp w_minus = diy_fp::multiply(b.minus, c_minus_k);
+    const diy_fp w_plus = diy_fp::multiply(b.plus, c_minus_k);
+
+    // Shrink the interval by one unit to account for the rounding errors of
+    // the multiplications
+    const diy_fp m_minus(w_minus.f + 1, w_minus.e);
+    const diy_fp m_plus(w_plus.f - 1, w_plus.e);
+
+    int length = 0;
+    decimal_exponent = -cached.k;
+    grisu2_digit_gen(buffer, length, decimal_exponent, m_minus, w, m_plus);
+    return length;
+}
+
+//-----------------------------------------------------------------------------
+// Layout
+//-----------------------------------------------------------------------------
+
+template <typename CharT>
+CharT *append_exponent(CharT *output, int exponent)
+{
+    if (exponent < 0)
+    {
+        *output++ = traits<CharT>::alpha_minus;
+        exponent = -exponent;
+    }
+    else
+    {
+        *output++ = traits<CharT>::alpha_plus;
+    }
+    // At least two digits like printf
+    if (exponent >= 100)
+    {
+        *output++ = CharT(traits<CharT>::alpha_0 + exponent / 100);
+        exponent %= 100;
+    }
+    *output++ = CharT(traits<CharT>::alpha_0 + exponent / 10);
+    *output++ = CharT(traits<CharT>::alpha_0 + exponent % 10);
+    return output;
+}
+
+// Writes digits * 10^exponent in decimal notation when the decimal point is
+// within [min_exponent, max_exponent], and in scientific notation otherwise.
+// The output always contains a decimal point or an exponent so that it is
+// read back as a real number.
+template <typename CharT>
+CharT *format_digits(CharT *output,
+                     const char *digits,
+                     int length,
+                     int exponent,
+                     int min_exponent,
+                     int max_exponent)
+{
+    // Position of the decimal point relative to the first digit
+    const int point = length + exponent;
+
+    if ((length <= point) && (point <= max_exponent))
+    {
+        // digits000.0
+        for (int i = 0; i < length; ++i)
+            *output++ = CharT(digits[i]);
+        for (int i = length; i < point; ++i)
+            *output++ = traits<CharT>::alpha_0;
+        *output++ = traits<CharT>::alpha_dot;
+        *output++ = traits<CharT>::alpha_0;
+        return output;
+    }
+
+    if ((0 < point) && (point <= max_exponent))
+    {
+        // dig.its
+        for (int i = 0; i < point; ++i)
+            *output++ = CharT(digits[i]);
+        *output++ = traits<CharT>::alpha_dot;
+        for (int i = point; i < length; ++i)
+            *output++ = CharT(digits[i]);
+        return output;
+    }
+
+    if ((min_exponent < point) && (point <= 0))
+    {
+        // 0.000digits
+        *output++ = traits<CharT>::alpha_0;
+        *output++ = traits<CharT>::alpha_dot;
+        for (int i = point; i < 0; ++i)
+            *output++ = traits<CharT>::alpha_0;
+        for (int i = 0; i < length; ++i)
+            *output++ = CharT(digits[i]);
+        return output;
+    }
+
+    // d.igitse+dd
+    *output++ = CharT(digits[0]);
+    if (length > 1)
+    {
+        *output++ = traits<CharT>::alpha_dot;
+        for (int i = 1; i < length; ++i)
+            *output++ = CharT(digits[i]);
+    }
+    *output++ = traits<CharT>::alpha_e;
+    return append_exponent(output, point - 1);
+}
+
+} // namespace real
+
+//-----------------------------------------------------------------------------
+// real_encoder
+//-----------------------------------------------------------------------------
+
+template <typename CharT, typename T, typename Enable = void>
+struct real_encoder;
+
+//! @brief Round-trip formatting of float and double.
+template <typename CharT, typename T>
+struct real_encoder<CharT,
+                    T,
+                    typename std::enable_if<std::is_same<T, float>::value ||
+                                            std::is_same<T, double>::value>::type>
+{
+    //! @brief Upper bound of the number of characters written by encode().
+    static const std::size_t max_length = 32;
+
+    //! @brief Write finite value to output.
+    //!
+    //! @returns End of the written characters.
+    static CharT *encode(T value, CharT *output)
+    {
+        assert(std::isfinite(value));
+
+        if (std::signbit(value))
+        {
+            *output++ = traits<CharT>::alpha_minus;
+            value = -value;
+        }
+        if (value == 0)
+        {
+            *output++ = traits<CharT>::alpha_0;
+            *output++ = traits<CharT>::alpha_dot;
+            *output++ = traits<CharT>::alpha_0;
+            return output;
+        }
+
+        char digits[std::numeric_limits<T>::max_digits10 + 1];
+        int exponent = 0;
+        const int length = real::grisu2(digits, exponent, value);
+        assert(length <= std::numeric_limits<T>::max_digits10);
+
+        return real::format_digits(output,
+                                   digits,
+                                   length,
+                                   exponent,
+                                   -4,
+                                   std::numeric_limits<T>::digits10);
+    }
+};
+
+//! @brief Round-trip formatting of long double.
+//!
+//! Grisu requires the significand plus guard bits to fit into 64 bits, so
+//! extended precision falls back to stream formatting with max_digits10.
+template <typename CharT, typename T>
+struct real_encoder<CharT,
+                    T,
+                    typename std::enable_if<std::is_same<T, long double>::value>::type>
+{
+    static const std::size_t max_length = std::numeric_limits<long double>::max_digits10 + 16;
+
+    static CharT *encode(T value, CharT *output)
+    {
+        assert(std::isfinite(value));
+
+        // Workaround for CharT = unsigned char, which std::locale does not support
+        std::ostringstream stream;
+        stream.imbue(std::locale::classic());
+        stream << std::setprecision(std::numeric_limits<long double>::max_digits10) << value;
+        const std::string work = stream.str();
+        assert(work.size() + 2 <= max_length);
+        for (char c : work)
+            *output++ = CharT(c);
+        if (work.find_first_of(".e") == std::string::npos)
+        {
+            *output++ = traits<CharT>::alpha_dot;
+            *output++ = traits<CharT>::alpha_0;
+        }
+        return output;
+    }
+};
+
+} // namespace detail
+} // namespace json
+} // namespace protocol
+} // namespace trial
+
+#endif // TRIAL_PROTOCOL_JSON_DETAIL_REAL_ENCODER_HPP
@@ -0,0 +1,650 @@
+#ifndef TRIAL_PROTOCOL_JSON_DETAIL_SCAN_HPP
+#define TRIAL_PROTOCOL_JSON_DETAIL_SCAN_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef> // std::size_t
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <boost/config.hpp>
+#include <boost/predef/other/endian.h>
+#include <trial/protocol/core/detail/simd.hpp>
+#include <trial/protocol/json/detail/traits.hpp>
+
+namespace trial
+{
+namespace protocol
+{
+namespace json
+{
+namespace detail
+{
+namespace scan
+{
+
+// Kernels operate on bytes. Each returns a pointer to the first byte in
+// [first, last) that does not belong to the scanned run, or last.
+
+//-----------------------------------------------------------------------------
+// Scalar kernels
+//-----------------------------------------------------------------------------
+
+inline bool is_space(unsigned char value) BOOST_NOEXCEPT
+{
+    return (value == 0x20) || (value == 0x0A) || (value == 0x0D) || (value == 0x09);
+}
+
+// Characters that cannot be skipped inside a string: quote, reverse solidus,
+// control characters, and UTF-8 sequences (which must be validated.)
+inline bool is_string_special(unsigned char value) BOOST_NOEXCEPT
+{
+    return (value == 0x22) || (value == 0x5C) || (value < 0x20) || (value >= 0x80);
+}
+
+// Characters that the encoder cannot copy verbatim: string specials and
+// solidus, which is always escaped.
+inline bool is_escape(unsigned char value) BOOST_NOEXCEPT
+{
+    return is_string_special(value) || (value == 0x2F);
+}
+
+// Characters that delimit strings and containers
+inline bool is_structural(unsigned char value) BOOST_NOEXCEPT
+{
+    // Case folding maps [ and ] onto { and }
+    return (value == 0x22) || ((value | 0x20) == 0x7B) || ((value | 0x20) == 0x7D);
+}
+
+inline const unsigned char *skip_whitespaces_scalar(const unsigned char *first,
+                                                    const unsigned char *last) BOOST_NOEXCEPT
+{
+    while ((first != last) && is_space(*first))
+        ++first;
+    return first;
+}
+
+inline const unsigned char *find_string_special_scalar(const unsigned char *first,
+                                                       const unsigned char *last) BOOST_NOEXCEPT
+{
+    while ((first != last) && !is_string_special(*first))
+        ++first;
+    return first;
+}
+
+inline const unsigned char *find_escape_scalar(const unsigned char *first,
+                                               const unsigned char *last) BOOST_NOEXCEPT
+{
+    while ((first != last) && !is_escape(*first))
+        ++first;
+    return first;
+}
+
+inline const unsigned char *find_structural_scalar(const unsigned char *first,
+                                                  const unsigned char *last) BOOST_NOEXCEPT
+{
+    while ((first != last) && !is_structural(*first))
+        ++first;
+    return first;
+}
+
+//-----------------------------------------------------------------------------
+// SWAR kernels
+//
+// Eight characters are loaded into an integer with the first character in the
+// least significant byte.
+//-----------------------------------------------------------------------------
+
+inline std::uint64_t load_eight(const unsigned char *first) BOOST_NOEXCEPT
+{
+    std::uint64_t result;
+    std::memcpy(&result, first, sizeof(result));
+#if BOOST_ENDIAN_BIG_BYTE
+    result = ((result & 0x00000000FFFFFFFFULL) << 32) | ((result & 0xFFFFFFFF00000000ULL) >> 32);
+    result = ((result & 0x0000FFFF0000FFFFULL) << 16) | ((result & 0xFFFF0000FFFF0000ULL) >> 16);
+    result = ((result & 0x00FF00FF00FF00FFULL) << 8) | ((result & 0xFF00FF00FF00FF00ULL) >> 8);
+#endif
+    return result;
+}
+
+inline bool is_eight_digits(std::uint64_t chunk) BOOST_NOEXCEPT
+{
+    // Digits are 0x30 to 0x39, so both the high nibble of each byte, and the
+    // high nibble after adding 6, must be 3
+    return ((chunk & 0xF0F0F0F0F0F0F0F0ULL) |
+            (((chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) == 0x3333333333333333ULL;
+}
+
+inline std::uint64_t parse_eight_digits(std::uint64_t chunk) BOOST_NOEXCEPT
+{
+    // Combine adjacent digits pairwise into 2, 4, and 8 digit numbers
+    chunk -= 0x3030303030303030ULL;
+    chunk = (chunk * 10) + (chunk >> 8);
+    chunk = (((chunk & 0x000000FF000000FFULL) * 0x000F424000000064ULL) +
+             (((chunk >> 16) & 0x000000FF000000FFULL) * 0x0000271000000001ULL)) >> 32;
+    return chunk;
+}
+
+//-----------------------------------------------------------------------------
+// SSE2 kernels
+//-----------------------------------------------------------------------------
+
+#if defined(TRIAL_PROTOCOL_SIMD_SSE2)
+
+inline const unsigned char *skip_whitespaces_sse2(const unsigned char *first,
+                                                  const unsigned char *last) BOOST_NOEXCEPT
+{
+    const __m128i space = _mm_set1_epi8(0x20);
+    const __m128i newline = _mm_set1_epi8(0x0A);
+    const __m128i carriage_return = _mm_set1_epi8(0x0D);
+    const __m128i tab = _mm_set1_epi8(0x09);
+
+    while (last - first >= 16)
+    {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(first));
+        const __m128i match = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, space),
+                                                        _mm_cmpeq_epi8(chunk, newline)),
+                                           _mm_or_si128(_mm_cmpeq_epi8(chunk, carriage_return),
+                                                        _mm_cmpeq_epi8(chunk, tab)));
+        const std::uint32_t mask = std::uint32_t(~_mm_movemask_epi8(match)) & 0xFFFFu;
+        if (mask != 0)
+            return first + core::detail::simd::count_trailing_zeros(mask);
+        first += 16;
+    }
+    return skip_whitespaces_scalar(first, last);
+}
+
+inline const unsigned char *find_string_special_sse2(const unsigned char *first,
+                                                     const unsigned char *last) BOOST_NOEXCEPT
+{
+    const __m128i quote = _mm_set1_epi8(0x22);
+    const __m128i reverse_solidus = _mm_set1_epi8(0x5C);
+    // Signed comparison also catches bytes with the high bit set
+    const __m128i space = _mm_set1_epi8(0x20);
+
+    while (last - first >= 16)
+    {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(first));
+        const __m128i match = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, quote),
+                                                        _mm_cmpeq_epi8(chunk, reverse_solidus)),
+                                           _mm_cmplt_epi8(chunk, space));
+        const std::uint32_t mask = std::uint32_t(_mm_movemask_epi8(match));
+        if (mask != 0)
+            return first + core::detail::simd::count_trailing_zeros(mask);
+        first += 16;
+    }
+    return find_string_special_scalar(first, last);
+}
+
+inline const unsigned char *find_escape_sse2(const unsigned char *first,
+                                             const unsigned char *last) BOOST_NOEXCEPT
+{
+    const __m128i quote = _mm_set1_epi8(0x22);
+    const __m128i reverse_solidus = _mm_set1_epi8(0x5C);
+    const __m128i solidus = _mm_set1_epi8(0x2F);
+    const __m128i space = _mm_set1_epi8(0x20);
+
+    while (last - first >= 16)
+    {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(first));
+        const __m128i match = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, quote),
+                                                        _mm_cmpeq_epi8(chunk, reverse_solidus)),
+                                           _mm_or_si128(_mm_cmpeq_epi8(chunk, solidus),
+                                                        _mm_cmplt_epi8(chunk, space)));
+        const std::uint32_t mask = std::uint32_t(_mm_movemask_epi8(match));
+        if (mask != 0)
+            return first + core::detail::simd::count_trailing_zeros(mask);
+        first += 16;
+    }
+    return find_escape_scalar(first, last);
+}
+
+inline const unsigned char *find_structural_sse2(const unsigned char *first,
+                                                 const unsigned char *last) BOOST_NOEXCEPT
+{
+    const __m128i quote = _mm_set1_epi8(0x22);
+    const __m128i fold = _mm_set1_epi8(0x20);
+    const __m128i brace_open = _mm_set1_epi8(0x7B);
+    const __m128i brace_close = _mm_set1_epi8(0x7D);
+
+    while (last - first >= 16)
+    {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(first));
+        const __m128i folded = _mm_or_si128(chunk, fold);
+        const __m128i match = _mm_or_si128(_mm_cmpeq_epi8(chunk, quote),
+                                           _mm_or_si128(_mm_cmpeq_epi8(folded, brace_open),
+                                                        _mm_cmpeq_epi8(folded, brace_close)));
+        const std::uint32_t mask = std::uint32_t(_mm_movemask_epi8(match));
+        if (mask != 0)
+            return first + core::detail::simd::count_trailing_zeros(mask);
+        first += 16;
+    }
+    return find_structural_scalar(first, last);
+}
+
+#endif
+
+//-----------------------------------------------------------------------------
+// AVX2 kernels
+//-----------------------------------------------------------------------------
+
+#if defined(TRIAL_PROTOCOL_SIMD_AVX2)
+
+TRIAL_PROTOCOL_SIMD_TARGET_AVX2
+inline const unsigned char *skip_whitespaces_avx2(const unsigned char *first,
+                                                  const unsigned char *last) BOOST_NOEXCEPT
+{
+    const __m256i space = _mm256_set1_epi8(0x20);
+    const __m256i newline = _mm256_set1_epi8(0x0A);
+    const __m256i carriage_return = _mm256_set1_epi8(0x0D);
+    const __m256i tab = _mm256_set1_epi8(0x09);
+
+    while (last - first >= 32)
+    {
+        const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(first));
+        const __m256i match = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(chunk, space),
+                                                              _mm256_cmpeq_epi8(chunk, newline)),
+                                              _mm256_or_si256(_mm256_cmpeq_epi8(chunk, carriage_return),
+                                                              _mm256_cmpeq_epi8(chunk, tab)));
+        const std::uint32_t mask = ~std::uint32_t(_mm256_movemask_epi8(match));
+        if (mask != 0)
+            return first + core::detail::simd::count_trailing_zeros(mask);
+        first += 32;
+    }
+    return skip_whitespaces_sse2(first, last);
+}
+
+TRIAL_PROTOCOL_SIMD_TARGET_AVX2
+inline const unsigned char *find_string_special_avx2(const unsigned char *first,
+                                                     const unsigned char *last) BOOST_NOEXCEPT
+{
+    const __m256i quote = _mm256_set1_epi8(0x22);
+    const __m256i reverse_solidus = _mm256_set1_epi8(0x5C);
+    // Signed comparison also catches bytes with the high bit set
+    const __m256i space = _mm256_set1_epi8(0x20);
+
+    while (last - first >= 32)
+    {
+        const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(first));
+        const __m256i match = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(chunk, quote),
+                                                              _mm256_cmpeq_epi8(chunk, reverse_solidus)),
+                                              _mm256_cmpgt_epi8(space, chunk));
+        const std::uint32_t mask = std::uint32_t(_mm256_movemask_epi8(match));
+        if (mask != 0)
+            return first + core::detail::simd::count_trailing_zeros(mask);
+        first += 32;
+    }
+    return find_string_special_sse2(first, last);
+}
+
+TRIAL_PROTOCOL_SIMD_TARGET_AVX2
+inline const unsigned char *find_escape_avx2(const unsigned char *first,
+                                             const unsigned char *last) BOOST_NOEXCEPT
+{
+    const __m256i quote = _mm256_set1_epi8(0x22);
+    const __m256i reverse_solidus = _mm256_set1_epi8(0x5C);
+    const __m256i solidus = _mm256_set1_epi8(0x2F);
+    const __m256i space = _mm256_set1_epi8(0x20);
+
+    while (last - first >= 32)
+    {
+        const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(first));
+        const __m256i match = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(chunk, quote),
+                                                              _mm256_cmpeq_epi8(chunk, reverse_solidus)),
+                                              _mm256_or_si256(_mm256_cmpeq_epi8(chunk, solidus),
+                                                              _mm256_cmpgt_epi8(space, chunk)));
+        const std::uint32_t mask = std::uint32_t(_mm256_movemask_epi8(match));
+        if (mask != 0)
+            return first + core::detail::simd::count_trailing_zeros(mask);
+        first += 32;
+    }
+    return find_escape_sse2(first, last);
+}
+
+TRIAL_PROTOCOL_SIMD_TARGET_AVX2
+inline const unsigned char *find_structural_avx2(const unsigned char *first,
+                                                 const unsigned char *last) BOOST_NOEXCEPT
+{
+    const __m256i quote = _mm256_set1_epi8(0x22);
+    const __m256i fold = _mm256_set1_epi8(0x20);
+    const __m256i brace_open = _mm256_set1_epi8(0x7B);
+    const __m256i brace_close = _mm256_set1_epi8(0x7D);
+
+    while (last - first >= 32)
+    {
+        const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(first));
+        const __m256i folded = _mm256_or_si256(chunk, fold);
+        const __m256i match = _mm256_or_si256(_mm256_cmpeq_epi8(chunk, quote),
+                                              _mm256_or_si256(_mm256_cmpeq_epi8(folded, brace_open),
+                                                              _mm256_cmpeq_epi8(folded, brace_close)));
+        const std::uint32_t mask = std::uint32_t(_mm256_movemask_epi8(match));
+        if (mask != 0)
+            return first + core::detail::simd::count_trailing_zeros(mask);
+        first += 32;
+    }
+    return find_structural_sse2(first, last);
+}
+
+#endif
+
+//-----------------------------------------------------------------------------
+// Dispatch
+//-----------------------------------------------------------------------------
+
+inline const unsigned char *skip_whitespaces(core::detail::simd::instruction_set isa,
+                                             const unsigned char *first,
+                                             const unsigned char *last) BOOST_NOEXCEPT
+{
+    switch (isa)
+    {
+#if defined(TRIAL_PROTOCOL_SIMD_AVX2)
+    case core::detail::simd::instruction_set::avx2:
+        return skip_whitespaces_avx2(first, last);
+#endif
+#if defined(TRIAL_PROTOCOL_SIMD_SSE2)
+    case core::detail::simd::instruction_set::sse2:
+        return skip_whitespaces_sse2(first, last);
+#endif
+    default:
+        return skip_whitespaces_scalar(first, last);
+    }
+}
+
+inline const unsigned char *find_string_special(core::detail::simd::instruction_set isa,
+                                                const unsigned char *first,
+                                                const unsigned char *last) BOOST_NOEXCEPT
+{
+    switch (isa)
+    {
+#if defined(TRIAL_PROTOCOL_SIMD_AVX2)
+    case core::detail::simd::instruction_set::avx2:
+        return find_string_special_avx2(first, last);
+#endif
+#if defined(TRIAL_PROTOCOL_SIMD_SSE2)
+    case core::detail::simd::instruction_set::sse2:
+        return find_string_special_sse2(first, last);
+#endif
+    default:
+        return find_string_special_scalar(first, last);
+    }
+}
+
+inline const unsigned char *find_escape(core::detail::simd::instruction_set isa,
+                                        const unsigned char *first,
+                                        const unsigned char *last) BOOST_NOEXCEPT
+{
+    switch (isa)
+    {
+#if defined(TRIAL_PROTOCOL_SIMD_AVX2)
+    case core::detail::simd::instruction_set::avx2:
+        return find_escape_avx2(first, last);
+#endif
+#if defined(TRIAL_PROTOCOL_SIMD_SSE2)
+    case core::detail::simd::instruction_set::sse2:
+        return find_escape_sse2(first, last);
+#endif
+    default:
+        return find_escape_scalar(first, last);
+    }
+}
+
+inline const unsigned char *find_structural(core::detail::simd::instruction_set isa,
+                                            const unsigned char *first,
+                                            const unsigned char *last) BOOST_NOEXCEPT
+{
+    switch (isa)
+    {
+#if defined(TRIAL_PROTOCOL_SIMD_AVX2)
+    case core::detail::simd::instruction_set::avx2:
+        return find_structural_avx2(first, last);
+#endif
+#if defined(TRIAL_PROTOCOL_SIMD_SSE2)
+    case core::detail::simd::instruction_set::sse2:
+        return find_structural_sse2(first, last);
+#endif
+    default:
+        return find_structural_scalar(first, last);
+    }
+}
+
+} // namespace scan
+
+//-----------------------------------------------------------------------------
+// scanner
+//-----------------------------------------------------------------------------
+
+// Accumulate decimal digits into value, and set overflow if the digits do not
+// fit into value. Returns the position after the last digit.
+template <typename CharT>
+const CharT *accumulate_digits(const CharT *first,
+                               const CharT *last,
+                               std::uint64_t& value,
+                               bool& overflow) BOOST_NOEXCEPT
+{
+    const std::uint64_t max = std::numeric_limits<std::uint64_t>::max();
+    for (; (first != last) && traits<CharT>::is_digit(*first); ++first)
+    {
+        const std::uint64_t digit = std::uint64_t(*first - traits<CharT>::alpha_0);
+        if (overflow || (value > (max - digit) / 10))
+        {
+            overflow = true;
+            continue;
+        }
+        value = value * 10 + digit;
+    }
+    return first;
+}
+
+template <typename CharT>
+struct scanner
+{
+    static const CharT *skip_whitespaces(const CharT *first, const CharT *last) BOOST_NOEXCEPT
+    {
+        while ((first != last) && traits<CharT>::is_space(*first))
+            ++first;
+        return first;
+    }
+
+    static const CharT *find_string_special(const CharT *first, const CharT *last) BOOST_NOEXCEPT
+    {
+        while ((first != last) && (traits<CharT>::to_category(*first) == traits_category::narrow))
+            ++first;
+        return first;
+    }
+
+    static const CharT *find_escape(const CharT *first, const CharT *last) BOOST_NOEXCEPT
+    {
+        while (first != last)
+        {
+            switch (*first)
+            {
+            case traits<CharT>::alpha_quote:
+            case traits<CharT>::alpha_reverse_solidus:
+            case traits<CharT>::alpha_solidus:
+                return first;
+            default:
+                if ((*first < CharT(0x20)) || (*first & 0x80))
+                    return first;
+                ++first;
+                break;
+            }
+        }
+        return first;
+    }
+
+    static const CharT *parse_digits(const CharT *first,
+                                     const CharT *last,
+                                     std::uint64_t& value,
+                                     bool& overflow) BOOST_NOEXCEPT
+    {
+        return accumulate_digits(first, last, value, overflow);
+    }
+
+    static const CharT *find_structural(const CharT *first, const CharT *last) BOOST_NOEXCEPT
+    {
+        while (first != last)
+        {
+            switch (*first)
+            {
+            case traits<CharT>::alpha_quote:
+            case traits<CharT>::alpha_bracket_open:
+            case traits<CharT>::alpha_bracket_close:
+            case traits<CharT>::alpha_brace_open:
+            case traits<CharT>::alpha_brace_close:
+                return first;
+            default:
+                ++first;
+                break;
+            }
+        }
+        return first;
+    }
+};
+
+template <typename CharT>
+struct byte_scanner
+{
+    static const CharT *skip_whitespaces(const CharT *first, const CharT *last) BOOST_NOEXCEPT
+    {
+        // Avoid the vector setup when there is no whitespace, which is the
+        // common case for minified input
+        if ((first == last) || !scan::is_space(static_cast<unsigned char>(*first)))
+            return first;
+        return reinterpret_cast<const CharT *>(
+            scan::skip_whitespaces(core::detail::simd::selected(),
+                                   reinterpret_cast<const unsigned char *>(first + 1),
+                                   reinterpret_cast<const unsigned char *>(last)));
+    }
+
+    static const CharT *find_string_special(const CharT *first, const CharT *last) BOOST_NOEXCEPT
+    {
+        return reinterpret_cast<const CharT *>(
+            scan::find_string_special(core::detail::simd::selected(),
+                                      reinterpret_cast<const unsigned char *>(first),
+                                      reinterpret_cast<const unsigned char *>(last)));
+    }
+
+    static const CharT *find_escape(const CharT *first, const CharT *last) BOOST_NOEXCEPT
+    {
+        return reinterpret_cast<const CharT *>(
+            scan::find_escape(core::detail::simd::selected(),
+                              reinterpret_cast<const unsigned char *>(first),
+                              reinterpret_cast<const unsigned char *>(last)));
+    }
+
+    static const CharT *parse_digits(const CharT *first,
+                                     const CharT *last,
+                                     std::uint64_t& value,
+                                     bool& overflow) BOOST_NOEXCEPT
+    {
+        // The first 16 digits cannot overflow, so they are converted eight
+        // at a time without overflow checks
+        for (int i = 0; (i < 2) && (last - first >= 8); ++i)
+        {
+            const std::uint64_t chunk = scan::load_eight(reinterpret_cast<const unsigned char *>(first));
+            if (!scan::is_eight_digits(chunk))
+                break;
+            value = value * 100000000 + scan::parse_eight_digits(chunk);
+            first += 8;
+        }
+        return accumulate_digits(first, last, value, overflow);
+    }
+
+    static const CharT *find_structural(const CharT *first, const CharT *last) BOOST_NOEXCEPT
+    {
+        return reinterpret_cast<const CharT *>(
+            scan::find_structural(core::detail::simd::selected(),
+                                  reinterpret_cast<const unsigned char *>(first),
+                                  reinterpret_cast<const unsigned char *>(last)));
+    }
+};
+
+template <>
+struct scanner<char> : public byte_scanner<char>
+{
+};
+
+template <>
+struct scanner<unsigned char> : public byte_scanner<unsigned char>
+{
+};
+
+//-----------------------------------------------------------------------------
+// Raw scanning
+//
+// Strings and containers are delimited without tokenizing or validating
+// their content.
+//-----------------------------------------------------------------------------
+
+//! @returns Position of the closing quote of a string whose content starts at
+//!          first, or last if the string is unterminated.
+template <typename CharT>
+const CharT *find_string_end(const CharT *first, const CharT *last) BOOST_NOEXCEPT
+{
+    while (true)
+    {
+        first = scanner<CharT>::find_string_special(first, last);
+        if (first == last)
+            return last;
+        if (*first == traits<CharT>::alpha_quote)
+            return first;
+        if (*first == traits<CharT>::alpha_reverse_solidus)
+        {
+            // Skip escaped character
+            if (++first == last)
+                return last;
+        }
+        ++first;
+    }
+}
+
+//! @returns Position of the bracket or brace that closes the container
+//!          opened at first, or last if the container is unterminated.
+//!
+//! Only the nesting depth is tracked, so mismatched closing characters must
+//! be detected by the caller.
+template <typename CharT>
+const CharT *find_container_end(const CharT *first, const CharT *last) BOOST_NOEXCEPT
+{
+    std::size_t depth = 0;
+    while (true)
+    {
+        first = scanner<CharT>::find_structural(first, last);
+        if (first == last)
+            return last;
+        switch (*first)
+        {
+        case traits<CharT>::alpha_quote:
+            first = find_string_end(first + 1, last);
+            if (first == last)
+                return last;
+            break;
+
+        case traits<CharT>::alpha_bracket_open:
+        case traits<CharT>::alpha_brace_open:
+            ++depth;
+            break;
+
+        default:
+            if (--depth == 0)
+                return first;
+            break;
+        }
+        ++first;
+    }
+}
+
+} // namespace detail
+} // namespace json
+} // namespace protocol
+} // namespace trial
+
+#endif // TRIAL_PROTOCOL_JSON_DETAIL_SCAN_HPP
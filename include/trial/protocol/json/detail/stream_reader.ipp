@@ -0,0 +1,223 @@
+#ifndef TRIAL_PROTOCOL_JSON_DETAIL_STREAM_READER_IPP
+#define TRIAL_PROTOCOL_JSON_DETAIL_STREAM_READER_IPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cassert>
+#include <trial/protocol/json/detail/traits.hpp>
+
+namespace trial
+{
+namespace protocol
+{
+namespace json
+{
+
+template <typename CharT>
+basic_stream_reader<CharT>::basic_stream_reader()
+    : reader(view_type()),
+      is_finished(false),
+      is_waiting(false)
+{
+    reader.decoder.relocate(view_type(buffer.data(), 0), 0, 0);
+    // The first token is parsed by next()
+    reader.decoder.code(token::detail::code::error_uninitialized);
+}
+
+template <typename CharT>
+void basic_stream_reader<CharT>::append(const view_type& chunk)
+{
+    assert(!is_finished);
+
+    // Discard consumed input except for the current token
+    const size_type literal_offset = offset(reader.decoder.literal());
+    const size_type input_offset = offset(reader.decoder.tail());
+    const size_type consumed = std::min(literal_offset, input_offset);
+    buffer.erase(0, consumed);
+    buffer.append(chunk.data(), chunk.size());
+    reader.decoder.relocate(view_type(buffer.data(), buffer.size()),
+                           literal_offset - consumed,
+                           input_offset - consumed);
+}
+
+template <typename CharT>
+void basic_stream_reader<CharT>::finish() BOOST_NOEXCEPT
+{
+    is_finished = true;
+}
+
+template <typename CharT>
+bool basic_stream_reader<CharT>::next()
+{
+    if (is_finished)
+    {
+        is_waiting = false;
+        return reader.next();
+    }
+
+    // Retain the state that basic_reader::next() modifies, so the token can
+    // be parsed again when more input has arrived
+    const decoder_type saved_decoder = reader.decoder;
+    const token::detail::code::value previous = saved_decoder.code();
+    const bool is_end_token = (previous == token::detail::code::end_array) ||
+        (previous == token::detail::code::end_object);
+    const size_type saved_size = reader.stack.size();
+    frame saved_frame = reader.stack.top();
+    if (is_end_token && (saved_size > 1))
+    {
+        // The enclosing frame is modified after the current frame is popped
+        const frame top = reader.stack.top();
+        reader.stack.pop();
+        saved_frame = reader.stack.top();
+        reader.stack.push(top);
+    }
+
+    const bool result = reader.next();
+    if (!is_incomplete())
+    {
+        is_waiting = false;
+        return result;
+    }
+
+    reader.decoder = saved_decoder;
+    if (reader.stack.size() > saved_size)
+    {
+        reader.stack.pop();
+    }
+    else if (reader.stack.size() < saved_size)
+    {
+        reader.stack.top() = saved_frame;
+        reader.stack.push(frame(previous));
+    }
+    else if (!is_end_token)
+    {
+        reader.stack.top() = saved_frame;
+    }
+    is_waiting = true;
+    return false;
+}
+
+template <typename CharT>
+bool basic_stream_reader<CharT>::next(token::code::value expect)
+{
+    if (reader.code() != expect)
+    {
+        reader.decoder.code(token::detail::code::error_unexpected_token);
+        return false;
+    }
+    return next();
+}
+
+template <typename CharT>
+bool basic_stream_reader<CharT>::needs_input() const BOOST_NOEXCEPT
+{
+    return is_waiting;
+}
+
+template <typename CharT>
+auto basic_stream_reader<CharT>::level() const BOOST_NOEXCEPT -> size_type
+{
+    return reader.level();
+}
+
+template <typename CharT>
+token::code::value basic_stream_reader<CharT>::code() const BOOST_NOEXCEPT
+{
+    return reader.code();
+}
+
+template <typename CharT>
+token::symbol::value basic_stream_reader<CharT>::symbol() const BOOST_NOEXCEPT
+{
+    return reader.symbol();
+}
+
+template <typename CharT>
+token::category::value basic_stream_reader<CharT>::category() const BOOST_NOEXCEPT
+{
+    return reader.category();
+}
+
+template <typename CharT>
+std::error_code basic_stream_reader<CharT>::error() const BOOST_NOEXCEPT
+{
+    return reader.error();
+}
+
+template <typename CharT>
+template <typename ReturnType>
+ReturnType basic_stream_reader<CharT>::value() const
+{
+    return reader.template value<ReturnType>();
+}
+
+template <typename CharT>
+auto basic_stream_reader<CharT>::string_view(std::basic_string<value_type>& scratch) const -> view_type
+{
+    return reader.string_view(scratch);
+}
+
+template <typename CharT>
+auto basic_stream_reader<CharT>::literal() const BOOST_NOEXCEPT -> const view_type&
+{
+    return reader.literal();
+}
+
+template <typename CharT>
+auto basic_stream_reader<CharT>::tail() const BOOST_NOEXCEPT -> const view_type&
+{
+    return reader.tail();
+}
+
+template <typename CharT>
+bool basic_stream_reader<CharT>::is_incomplete() const BOOST_NOEXCEPT
+{
+    switch (reader.symbol())
+    {
+    case token::symbol::end:
+        return true;
+
+    case token::symbol::error:
+        {
+            // Errors near the end of the input may be caused by a truncated
+            // token, such as a keyword that is shorter than "false"
+            const view_type& literal = reader.decoder.literal();
+            const size_type distance = buffer.size() - (offset(literal) + literal.size());
+            return distance < detail::traits<CharT>::false_text().size();
+        }
+
+    case token::symbol::null:
+    case token::symbol::boolean:
+    case token::symbol::integer:
+    case token::symbol::real:
+        // Numbers and keywords may continue in the next chunk
+        return reader.decoder.tail().empty();
+
+    default:
+        return false;
+    }
+}
+
+template <typename CharT>
+auto basic_stream_reader<CharT>::offset(const view_type& view) const BOOST_NOEXCEPT -> size_type
+{
+    assert(view.data() >= buffer.data());
+    assert(view.data() <= buffer.data() + buffer.size());
+
+    return size_type(view.data() - buffer.data());
+}
+
+} // namespace json
+} // namespace protocol
+} // namespace trial
+
+#endif // TRIAL_PROTOCOL_JSON_DETAIL_STREAM_READER_IPP
@@ -11,7 +11,6 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
-#include <cstdlib>
 #include <limits>
 #include <string>
 #include <sstream>
@@ -19,6 +18,7 @@
 #include <locale>
 #include <trial/protocol/core/detail/string_view.hpp>
 #include <trial/protocol/core/char_traits.hpp>
+#include <trial/protocol/json/detail/real_decoder.hpp>
 
 namespace trial
 {
@@ -52,7 +52,7 @@ struct string_converter<CharT, float>
 
     static float decode(const string_view& view)
     {
-        return std::strtof(view.data(), nullptr);
+        return real_decoder<CharT, float>::decode(view);
     }
 };
 
@@ -74,7 +74,7 @@ struct string_converter<CharT, double>
 
     static double decode(const string_view& view)
     {
-        return std::strtod(view.data(), nullptr);
+        return real_decoder<CharT, double>::decode(view);
     }
 };
 
@@ -96,7 +96,7 @@ struct string_converter<CharT, long double>
 
     static long double decode(const string_view& view)
     {
-        return std::strtold(view.data(), nullptr);
+        return real_decoder<CharT, long double>::decode(view);
     }
 };
 
@@ -0,0 +1,277 @@
+#ifndef TRIAL_PROTOCOL_JSON_DETAIL_TAPE_IPP
+#define TRIAL_PROTOCOL_JSON_DETAIL_TAPE_IPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <trial/protocol/core/detail/small_stack.hpp>
+#include <trial/protocol/json/error.hpp>
+#include <trial/protocol/json/detail/traits.hpp>
+
+namespace trial
+{
+namespace protocol
+{
+namespace json
+{
+
+//-----------------------------------------------------------------------------
+// basic_tape
+//-----------------------------------------------------------------------------
+
+template <typename CharT>
+basic_tape<CharT>::basic_tape(const view_type& view)
+    : input(view)
+{
+    if (input.size() >= std::numeric_limits<index_type>::max())
+        throw std::length_error("json::tape input");
+
+    entries.reserve(count_tokens(input));
+    basic_reader<CharT> reader(input);
+    // Positions of unfinished containers
+    core::detail::small_stack<index_type, 32> scope;
+
+    while (true)
+    {
+        const index_type position = index_type(entries.size());
+
+        switch (reader.symbol())
+        {
+        case token::symbol::error:
+            throw json::error(reader.error());
+
+        case token::symbol::end:
+            // The literal of the end token is not updated by the reader
+            entries.push_back({ index_type(input.size()),
+                                0,
+                                position,
+                                std::uint8_t(reader.decoder.code()),
+                                false });
+            return;
+
+        default:
+            {
+                const auto& literal = reader.literal();
+                entries.push_back({ index_type(literal.data() - input.data()),
+                                    index_type(literal.size()),
+                                    position,
+                                    std::uint8_t(reader.decoder.code()),
+                                    reader.decoder.escaped() });
+            }
+            break;
+        }
+
+        switch (reader.symbol())
+        {
+        case token::symbol::begin_array:
+        case token::symbol::begin_object:
+            scope.push(position);
+            break;
+
+        case token::symbol::end_array:
+            if (scope.empty())
+                throw json::error(make_error_code(json::unbalanced_end_array));
+            entries[position].partner = scope.top();
+            entries[scope.top()].partner = position;
+            scope.pop();
+            break;
+
+        case token::symbol::end_object:
+            if (scope.empty())
+                throw json::error(make_error_code(json::unbalanced_end_object));
+            entries[position].partner = scope.top();
+            entries[scope.top()].partner = position;
+            scope.pop();
+            break;
+
+        default:
+            break;
+        }
+
+        reader.next();
+    }
+}
+
+// Upper bound on the number of tokens. Every value or key is preceded by a
+// begin bracket, a comma, or a colon, except for the outermost value, and
+// every end bracket is a token. Delimiters inside strings are skipped.
+template <typename CharT>
+auto basic_tape<CharT>::count_tokens(const view_type& input) BOOST_NOEXCEPT -> size_type
+{
+    using traits_type = detail::traits<CharT>;
+
+    // Outermost value and end token
+    size_type result = 2;
+    auto it = input.begin();
+    const auto end = input.end();
+    while (it != end)
+    {
+        switch (*it)
+        {
+        case traits_type::alpha_quote:
+            for (++it; (it != end) && (*it != traits_type::alpha_quote); ++it)
+            {
+                if ((*it == traits_type::alpha_reverse_solidus) && (std::next(it) != end))
+                    ++it;
+            }
+            if (it == end)
+                return result;
+            break;
+
+        case traits_type::alpha_bracket_open:
+        case traits_type::alpha_bracket_close:
+        case traits_type::alpha_brace_open:
+        case traits_type::alpha_brace_close:
+        case traits_type::alpha_comma:
+        case traits_type::alpha_colon:
+            ++result;
+            break;
+
+        default:
+            break;
+        }
+        ++it;
+    }
+    return result;
+}
+
+template <typename CharT>
+auto basic_tape<CharT>::size() const BOOST_NOEXCEPT -> size_type
+{
+    return entries.size();
+}
+
+template <typename CharT>
+auto basic_tape<CharT>::begin() const BOOST_NOEXCEPT -> cursor
+{
+    return cursor(*this);
+}
+
+//-----------------------------------------------------------------------------
+// basic_tape::cursor
+//-----------------------------------------------------------------------------
+
+template <typename CharT>
+basic_tape<CharT>::cursor::cursor(const basic_tape<CharT>& tape) BOOST_NOEXCEPT
+    : tape(&tape),
+      current(0),
+      depth(0)
+{
+}
+
+template <typename CharT>
+bool basic_tape<CharT>::cursor::next() BOOST_NOEXCEPT
+{
+    switch (symbol())
+    {
+    case token::symbol::end:
+        return false;
+
+    case token::symbol::begin_array:
+    case token::symbol::begin_object:
+        ++depth;
+        break;
+
+    case token::symbol::end_array:
+    case token::symbol::end_object:
+        --depth;
+        break;
+
+    default:
+        break;
+    }
+    ++current;
+    return symbol() != token::symbol::end;
+}
+
+template <typename CharT>
+bool basic_tape<CharT>::cursor::skip() BOOST_NOEXCEPT
+{
+    switch (symbol())
+    {
+    case token::symbol::begin_array:
+    case token::symbol::begin_object:
+        current = tape->entries[current].partner + 1;
+        return symbol() != token::symbol::end;
+
+    default:
+        return next();
+    }
+}
+
+template <typename CharT>
+auto basic_tape<CharT>::cursor::level() const BOOST_NOEXCEPT -> size_type
+{
+    return depth;
+}
+
+template <typename CharT>
+auto basic_tape<CharT>::cursor::position() const BOOST_NOEXCEPT -> size_type
+{
+    return current;
+}
+
+template <typename CharT>
+token::code::value basic_tape<CharT>::cursor::code() const BOOST_NOEXCEPT
+{
+    return token::detail::convert(token::detail::code::value(tape->entries[current].code));
+}
+
+template <typename CharT>
+token::symbol::value basic_tape<CharT>::cursor::symbol() const BOOST_NOEXCEPT
+{
+    return token::symbol::convert(code());
+}
+
+template <typename CharT>
+token::category::value basic_tape<CharT>::cursor::category() const BOOST_NOEXCEPT
+{
+    return token::category::convert(code());
+}
+
+template <typename CharT>
+template <typename ReturnType>
+ReturnType basic_tape<CharT>::cursor::value() const
+{
+    // The token has already been scanned, so only the conversion remains
+    const basic_reader<CharT, 1> reader(token_decoder());
+    return reader.template value<ReturnType>();
+}
+
+template <typename CharT>
+auto basic_tape<CharT>::cursor::string_view(std::basic_string<value_type>& scratch) const -> view_type
+{
+    return token_decoder().string_view(scratch);
+}
+
+template <typename CharT>
+auto basic_tape<CharT>::cursor::literal() const BOOST_NOEXCEPT -> view_type
+{
+    const auto& entry = tape->entries[current];
+    return view_type(tape->input.data() + entry.offset, entry.length);
+}
+
+template <typename CharT>
+auto basic_tape<CharT>::cursor::token_decoder() const BOOST_NOEXCEPT -> detail::basic_decoder<CharT>
+{
+    const auto& entry = tape->entries[current];
+    return detail::basic_decoder<CharT>(token::detail::code::value(entry.code),
+                                        literal(),
+                                        entry.escaped);
+}
+
+} // namespace json
+} // namespace protocol
+} // namespace trial
+
+#endif // TRIAL_PROTOCOL_JSON_DETAIL_TAPE_IPP
@@ -39,6 +39,7 @@ inline symbol::value symbol::convert(code::value value)
     case code::error_unbalanced_end_object:
     case code::error_expected_end_array:
     case code::error_expected_end_object:
+    case code::error_nesting_limit:
         return symbol::error;
 
     case code::null:
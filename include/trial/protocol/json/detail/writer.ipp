@@ -25,77 +25,77 @@ namespace json
 // writer::overloader
 //-----------------------------------------------------------------------------
 
-template <typename CharT, std::size_t N>
+template <typename CharT, std::size_t N, typename OutputType>
 template <typename T, typename Enable>
-struct basic_writer<CharT, N>::overloader
+struct basic_writer<CharT, N, OutputType>::overloader
 {
 };
 
-template <typename CharT, std::size_t N>
+template <typename CharT, std::size_t N, typename OutputType>
 template <typename T>
-struct basic_writer<CharT, N>::overloader<
+struct basic_writer<CharT, N, OutputType>::overloader<
     T,
     typename std::enable_if<std::is_same<T, token::null>::value>::type>
 {
-    using size_type = typename basic_writer<CharT, N>::size_type;
+    using size_type = typename basic_writer<CharT, N, OutputType>::size_type;
 
-    inline static size_type value(basic_writer<CharT, N>& self)
+    inline static size_type value(basic_writer<CharT, N, OutputType>& self)
     {
         return self.null_value();
     }
 };
 
-template <typename CharT, std::size_t N>
+template <typename CharT, std::size_t N, typename OutputType>
 template <typename T>
-struct basic_writer<CharT, N>::overloader<
+struct basic_writer<CharT, N, OutputType>::overloader<
     T,
     typename std::enable_if<std::is_same<T, token::begin_array>::value>::type>
 {
-    using size_type = typename basic_writer<CharT, N>::size_type;
+    using size_type = typename basic_writer<CharT, N, OutputType>::size_type;
 
-    inline static size_type value(basic_writer<CharT, N>& self)
+    inline static size_type value(basic_writer<CharT, N, OutputType>& self)
     {
         return self.begin_array_value();
     }
 };
 
-template <typename CharT, std::size_t N>
+template <typename CharT, std::size_t N, typename OutputType>
 template <typename T>
-struct basic_writer<CharT, N>::overloader<
+struct basic_writer<CharT, N, OutputType>::overloader<
     T,
     typename std::enable_if<std::is_same<T, token::end_array>::value>::type>
 {
-    using size_type = typename basic_writer<CharT, N>::size_type;
+    using size_type = typename basic_writer<CharT, N, OutputType>::size_type;
 
-    inline static size_type value(basic_writer<CharT, N>& self)
+    inline static size_type value(basic_writer<CharT, N, OutputType>& self)
     {
         return self.end_array_value();
     }
 };
 
-template <typename CharT, std::size_t N>
+template <typename CharT, std::size_t N, typename OutputType>
 template <typename T>
-struct basic_writer<CharT, N>::overloader<
+struct basic_writer<CharT, N, OutputType>::overloader<
     T,
     typename std::enable_if<std::is_same<T, token::begin_object>::value>::type>
 {
-    using size_type = typename basic_writer<CharT, N>::size_type;
+    using size_type = typename basic_writer<CharT, N, OutputType>::size_type;
 
-    inline static size_type value(basic_writer<CharT, N>& self)
+    inline static size_type value(basic_writer<CharT, N, OutputType>& self)
     {
         return self.begin_object_value();
     }
 };
 
-template <typename CharT, std::size_t N>
+template <typename CharT, std::size_t N, typename OutputType>
 template <typename T>
-struct basic_writer<CharT, N>::overloader<
+struct basic_writer<CharT, N, OutputType>::overloader<
     T,
     typename std::enable_if<std::is_same<T, token::end_object>::value>::type>
 {
-    using size_type = typename basic_writer<CharT, N>::size_type;
+    using size_type = typename basic_writer<CharT, N, OutputType>::size_type;
 
-    inline static size_type value(basic_writer<CharT, N>& self)
+    inline static size_type value(basic_writer<CharT, N, OutputType>& self)
     {
         return self.end_object_value();
     }
@@ -105,37 +105,37 @@ struct basic_writer<CharT, N>::overloader<
 // writer
 //-----------------------------------------------------------------------------
 
-template <typename CharT, std::size_t N>
+template <typename CharT, std::size_t N, typename OutputType>
 template <typename T>
-basic_writer<CharT, N>::basic_writer(T& buffer)
-    : encoder(buffer)
+basic_writer<CharT, N, OutputType>::basic_writer(T& buffer, json::real_format format)
+    : encoder(buffer, format)
 {
     // Push outermost scope
     stack.push(frame(encoder, token::code::end_array));
 }
 
-template <typename CharT, std::size_t N>
-std::error_code basic_writer<CharT, N>::error() const BOOST_NOEXCEPT
+template <typename CharT, std::size_t N, typename OutputType>
+std::error_code basic_writer<CharT, N, OutputType>::error() const BOOST_NOEXCEPT
 {
     return make_error_code(last_error);
 }
 
-template <typename CharT, std::size_t N>
-auto basic_writer<CharT, N>::level() const BOOST_NOEXCEPT -> size_type
+template <typename CharT, std::size_t N, typename OutputType>
+auto basic_writer<CharT, N, OutputType>::level() const BOOST_NOEXCEPT -> size_type
 {
     return stack.size() - 1;
 }
 
-template <typename CharT, std::size_t N>
+template <typename CharT, std::size_t N, typename OutputType>
 template <typename T>
-auto basic_writer<CharT, N>::value() -> size_type
+auto basic_writer<CharT, N, OutputType>::value() -> size_type
 {
-    return basic_writer<CharT, N>::overloader<T>::value(*this);
+    return basic_writer<CharT, N, OutputType>::overloader<T>::value(*this);
 }
 
-template <typename CharT, std::size_t N>
+template <typename CharT, std::size_t N, typename OutputType>
 template <typename T>
-auto basic_writer<CharT, N>::value(T&& data) -> size_type
+auto basic_writer<CharT, N, OutputType>::value(T&& data) -> size_type
 {
     validate_scope();
 
@@ -143,14 +143,14 @@ auto basic_writer<CharT, N>::value(T&& data) -> size_type
     return encoder.value(std::forward<T>(data));
 }
 
-template <typename CharT, std::size_t N>
-auto basic_writer<CharT, N>::literal(const view_type& data) BOOST_NOEXCEPT -> size_type
+template <typename CharT, std::size_t N, typename OutputType>
+auto basic_writer<CharT, N, OutputType>::literal(const view_type& data) BOOST_NOEXCEPT -> size_type
 {
     return encoder.literal(data);
 }
 
-template <typename CharT, std::size_t N>
-void basic_writer<CharT, N>::validate_scope()
+template <typename CharT, std::size_t N, typename OutputType>
+void basic_writer<CharT, N, OutputType>::validate_scope()
 {
     if (stack.empty())
     {
@@ -159,8 +159,8 @@ void basic_writer<CharT, N>::validate_scope()
     }
 }
 
-template <typename CharT, std::size_t N>
-void basic_writer<CharT, N>::validate_scope(token::code::value code,
+template <typename CharT, std::size_t N, typename OutputType>
+void basic_writer<CharT, N, OutputType>::validate_scope(token::code::value code,
                                             enum json::errc e)
 {
     if ((stack.size() < 2) || (stack.top().code != code))
@@ -170,8 +170,8 @@ void basic_writer<CharT, N>::validate_scope(token::code::value code,
     }
 }
 
-template <typename CharT, std::size_t N>
-auto basic_writer<CharT, N>::null_value() -> size_type
+template <typename CharT, std::size_t N, typename OutputType>
+auto basic_writer<CharT, N, OutputType>::null_value() -> size_type
 {
     validate_scope();
 
@@ -179,8 +179,8 @@ auto basic_writer<CharT, N>::null_value() -> size_type
     return encoder.template value<token::null>();
 }
 
-template <typename CharT, std::size_t N>
-auto basic_writer<CharT, N>::begin_array_value() -> size_type
+template <typename CharT, std::size_t N, typename OutputType>
+auto basic_writer<CharT, N, OutputType>::begin_array_value() -> size_type
 {
     validate_scope();
 
@@ -189,8 +189,8 @@ auto basic_writer<CharT, N>::begin_array_value() -> size_type
     return encoder.template value<token::begin_array>();
 }
 
-template <typename CharT, std::size_t N>
-auto basic_writer<CharT, N>::end_array_value() -> size_type
+template <typename CharT, std::size_t N, typename OutputType>
+auto basic_writer<CharT, N, OutputType>::end_array_value() -> size_type
 {
     validate_scope(token::code::end_array, json::unexpected_token);
 
@@ -199,8 +199,8 @@ auto basic_writer<CharT, N>::end_array_value() -> size_type
     return result;
 }
 
-template <typename CharT, std::size_t N>
-auto basic_writer<CharT, N>::begin_object_value() -> size_type
+template <typename CharT, std::size_t N, typename OutputType>
+auto basic_writer<CharT, N, OutputType>::begin_object_value() -> size_type
 {
     validate_scope();
 
@@ -209,8 +209,8 @@ auto basic_writer<CharT, N>::begin_object_value() -> size_type
     return encoder.template value<token::begin_object>();
 }
 
-template <typename CharT, std::size_t N>
-auto basic_writer<CharT, N>::end_object_value() -> size_type
+template <typename CharT, std::size_t N, typename OutputType>
+auto basic_writer<CharT, N, OutputType>::end_object_value() -> size_type
 {
     validate_scope(token::code::end_object, json::unexpected_token);
 
@@ -223,8 +223,8 @@ auto basic_writer<CharT, N>::end_object_value() -> size_type
 // frame
 //-----------------------------------------------------------------------------
 
-template <typename CharT, std::size_t N>
-basic_writer<CharT, N>::frame::frame(encoder_type& encoder,
+template <typename CharT, std::size_t N, typename OutputType>
+basic_writer<CharT, N, OutputType>::frame::frame(encoder_type& encoder,
                                      token::code::value code)
     : encoder(encoder),
       code(code),
@@ -232,8 +232,8 @@ basic_writer<CharT, N>::frame::frame(encoder_type& encoder,
 {
 }
 
-template <typename CharT, std::size_t N>
-void basic_writer<CharT, N>::frame::write_separator()
+template <typename CharT, std::size_t N, typename OutputType>
+void basic_writer<CharT, N, OutputType>::frame::write_separator()
 {
     if (counter != 0)
     {
@@ -35,7 +35,11 @@ enum errc
     expected_end_array,
     expected_end_object,
 
-    insufficient_tokens
+    insufficient_tokens,
+
+    nesting_limit,
+
+    invalid_path
 };
 
 const std::error_category& error_category();
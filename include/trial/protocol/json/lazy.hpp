@@ -0,0 +1,121 @@
+#ifndef TRIAL_PROTOCOL_JSON_LAZY_HPP
+#define TRIAL_PROTOCOL_JSON_LAZY_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef> // std::size_t
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <boost/config.hpp>
+#include <trial/dynamic/variable.hpp>
+#include <trial/protocol/json/reader.hpp>
+#include <trial/protocol/json/token.hpp>
+
+namespace trial
+{
+namespace protocol
+{
+namespace json
+{
+
+//! @brief Handle to JSON formatted data that is decoded on demand.
+//!
+//! Arrays and objects are not decoded when the handle is created. Instead
+//! the boundaries of their immediate elements are located by a structural
+//! scan on first access, and each element is returned as another handle.
+//! Only the subtrees that are converted with value() are decoded into a
+//! dynamic variable, so the cost of decoding is proportional to the part of
+//! the document that is actually used.
+//!
+//! The content of containers is validated when it is decoded, not when it
+//! is skipped.
+//!
+//! The handle does not assume ownership of the input buffer. Accessing the
+//! same handle concurrently from several threads is not safe, because the
+//! element boundaries are located lazily.
+template <template <typename> class Allocator = std::allocator>
+class basic_lazy
+{
+public:
+    using variable_type = dynamic::basic_variable<Allocator>;
+    using view_type = json::reader::view_type;
+    using size_type = std::size_t;
+
+    //! @brief Construct handle for a single JSON value.
+    //!
+    //! @param[in] input A string view of a JSON formatted buffer.
+    //! @throws json::error If the input does not start with a value.
+    explicit basic_lazy(const view_type& input);
+
+    //! @returns The symbol of the value.
+    token::symbol::value symbol() const BOOST_NOEXCEPT;
+
+    //! @returns A view of the encoded value without surrounding whitespaces.
+    const view_type& literal() const BOOST_NOEXCEPT;
+
+    //! @returns The number of elements in an array or members in an object.
+    //! @throws json::error If the value is not an array or an object.
+    size_type size() const;
+
+    //! @brief Get array element.
+    //!
+    //! @throws json::error If the value is not an array.
+    //! @throws std::out_of_range If the index is past the last element.
+    basic_lazy operator[](size_type index) const;
+
+    //! @brief Get object member.
+    //!
+    //! @throws json::error If the value is not an object.
+    //! @throws std::out_of_range If the object has no member with the key.
+    basic_lazy operator[](const std::string& key) const;
+
+    //! @returns 1 if the object has a member with the key, 0 otherwise.
+    //! @throws json::error If the value is not an object.
+    size_type count(const std::string& key) const;
+
+    //! @brief Decode the value into a dynamic variable.
+    //!
+    //! @throws json::error If the value is not valid JSON.
+    variable_type value() const;
+
+#ifndef BOOST_DOXYGEN_INVOKED
+private:
+    basic_lazy(const view_type& literal, token::symbol::value symbol);
+
+    struct entry
+    {
+        std::string key;
+        view_type literal;
+        token::symbol::value symbol;
+    };
+
+    const std::vector<entry>& entries() const;
+    const entry *find(const std::string& key) const;
+
+private:
+    view_type input;
+    token::symbol::value current;
+    mutable bool expanded;
+    mutable std::vector<entry> elements;
+#endif
+};
+
+using lazy = basic_lazy<>;
+
+} // namespace json
+} // namespace protocol
+} // namespace trial
+
+#include <trial/protocol/json/detail/lazy.ipp>
+
+#endif // TRIAL_PROTOCOL_JSON_LAZY_HPP
@@ -0,0 +1,72 @@
+#ifndef TRIAL_PROTOCOL_JSON_LINE_READER_HPP
+#define TRIAL_PROTOCOL_JSON_LINE_READER_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <boost/config.hpp>
+#include <trial/protocol/json/reader.hpp>
+
+namespace trial
+{
+namespace protocol
+{
+namespace json
+{
+
+//! @brief Reader of newline-delimited JSON documents.
+//!
+//! Splits a buffer in the JSON Lines (NDJSON) format into its documents, one
+//! per line, without parsing them. Each document can be passed on to a
+//! json::reader or to json::parse(). Blank lines are skipped.
+//!
+//! The line reader does not assume ownership of the input buffer.
+template <typename CharT>
+class basic_line_reader
+{
+public:
+    using value_type = typename basic_reader<CharT>::value_type;
+    using size_type = typename basic_reader<CharT>::size_type;
+    using view_type = typename basic_reader<CharT>::view_type;
+
+    //! @brief Construct a line reader.
+    //!
+    //! The reader is positioned before the first document.
+    //!
+    //! @param[in] input A string view of a buffer of newline-delimited JSON.
+    explicit basic_line_reader(const view_type& input) BOOST_NOEXCEPT;
+
+    //! @brief Advance to the next document.
+    //!
+    //! @returns false if the end of the input was reached, true otherwise.
+    bool next() BOOST_NOEXCEPT;
+
+    //! @returns A view of the current document without the line terminator.
+    const view_type& literal() const BOOST_NOEXCEPT;
+
+    //! @returns A view of the input after the current document.
+    const view_type& tail() const BOOST_NOEXCEPT;
+
+#ifndef BOOST_DOXYGEN_INVOKED
+private:
+    view_type current;
+    view_type remaining;
+#endif
+};
+
+using line_reader = basic_line_reader<char>;
+
+} // namespace json
+} // namespace protocol
+} // namespace trial
+
+#include <trial/protocol/json/detail/line_reader.ipp>
+
+#endif // TRIAL_PROTOCOL_JSON_LINE_READER_HPP
@@ -0,0 +1,101 @@
+#ifndef TRIAL_PROTOCOL_JSON_PARALLEL_PARSE_HPP
+#define TRIAL_PROTOCOL_JSON_PARALLEL_PARSE_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef> // std::size_t
+#include <trial/dynamic/variable.hpp>
+#include <trial/protocol/core/arena.hpp>
+#include <trial/protocol/core/detail/parallel.hpp>
+#include <trial/protocol/json/line_reader.hpp>
+#include <trial/protocol/json/parse.hpp>
+#include <trial/protocol/json/detail/parallel_parse.ipp>
+
+namespace trial
+{
+namespace protocol
+{
+namespace json
+{
+
+//! @brief Decode JSON formatted data into dynamic variable using several threads.
+//!
+//! If the input is an array, then the elements of the array are located with
+//! a structural scan, divided into contiguous ranges of roughly equal size,
+//! and the ranges are decoded concurrently. The decoded elements are stored
+//! in the returned array in the same order as in the input. Other input is
+//! decoded by json::parse() on the calling thread.
+//!
+//! Each element is decoded with default-constructed allocators by the thread
+//! that decodes it, and then moved into the result by the calling thread.
+//! With core::arena_allocator only the elements decoded by the calling thread
+//! are allocated from its arena, because an arena is not thread-safe. The
+//! remaining elements are allocated from the heap.
+//!
+//! @param input The JSON formatted input buffer.
+//! @param concurrency Maximum number of threads, including the calling thread.
+//! @returns Dynamic variable containing the decoded JSON data.
+
+template <typename U, template <typename> class Allocator = std::allocator>
+auto parallel_parse(const U& input,
+                    std::size_t concurrency = core::detail::default_concurrency()) -> dynamic::basic_variable<Allocator>
+{
+    detail::parallel_parser<Allocator> parser(input);
+    return parser.parse(concurrency);
+}
+
+//! @brief Decode newline-delimited JSON documents using several threads.
+//!
+//! The input, in the JSON Lines (NDJSON) format, is divided at line boundaries
+//! into chunks of roughly equal size, and each chunk is processed by its own
+//! thread. The documents of a chunk are decoded in order into a variable that
+//! is allocated from an arena owned by the thread, and then passed to
+//! @c function. The arena is reset after each document, so the document must
+//! not be retained after @c function returns. Blank lines are skipped.
+//!
+//! @c function is invoked concurrently from several threads.
+//!
+//! If a document cannot be decoded, then the remaining documents of its chunk
+//! are skipped, and the error is thrown after all threads have completed.
+//!
+//! @param input The newline-delimited JSON input buffer.
+//! @param function Callable with the signature
+//!        void(const dynamic::basic_variable<core::arena_allocator>&).
+//! @param concurrency Maximum number of threads, including the calling thread.
+
+template <typename Function>
+void parallel_parse_lines(const json::reader::view_type& input,
+                          Function function,
+                          std::size_t concurrency = core::detail::default_concurrency())
+{
+    const auto chunks = detail::split_lines(input, concurrency);
+    core::detail::parallel_invoke(
+        chunks.size(),
+        [&chunks, &function] (std::size_t task)
+        {
+            core::arena memory;
+            json::line_reader lines(chunks[task]);
+            while (lines.next())
+            {
+                {
+                    const auto document = json::parse(lines.literal(), memory);
+                    function(document);
+                }
+                memory.reset();
+            }
+        });
+}
+
+} // namespace json
+} // namespace protocol
+} // namespace trial
+
+#endif // TRIAL_PROTOCOL_JSON_PARALLEL_PARSE_HPP
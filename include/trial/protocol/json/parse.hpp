@@ -12,6 +12,8 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <trial/dynamic/variable.hpp>
+#include <trial/dynamic/interned_variable.hpp>
+#include <trial/protocol/core/arena.hpp>
 #include <trial/protocol/json/reader.hpp>
 #include <trial/protocol/json/detail/parse.ipp>
 
@@ -41,6 +43,39 @@ auto parse(json::reader& reader) -> dynamic::basic_variable<Allocator>
     return parser.parse();
 }
 
+//! @brief Decode JSON formatted data into arena-allocated dynamic variable.
+//!
+//! Same as partial::parse(json::reader&) except that all containers and
+//! strings are allocated from @c memory.
+//!
+//! @param reader Reader pointing to an arbitrary position within a buffer.
+//! @param memory Arena that must outlive the returned variable.
+//! @returns Dynamic variable containing the decoded JSON data.
+
+inline auto parse(json::reader& reader,
+                  core::arena& memory) -> dynamic::basic_variable<core::arena_allocator>
+{
+    core::arena::scope scope(memory);
+    return partial::parse<core::arena_allocator>(reader);
+}
+
+//! @brief Decode JSON formatted data into dynamic variable with interned keys.
+//!
+//! Same as partial::parse(json::reader&) except that the keys of objects are
+//! obtained from @c pool, so keys with the same characters share storage
+//! with each other and with keys from other documents decoded with the pool.
+//!
+//! @param reader Reader pointing to an arbitrary position within a buffer.
+//! @param pool Pool of interned keys.
+//! @returns Dynamic variable containing the decoded JSON data.
+
+inline auto parse(json::reader& reader,
+                  dynamic::string_pool& pool) -> dynamic::interned_variable
+{
+    detail::basic_parser<char, dynamic::interned_allocator> parser(reader, pool);
+    return parser.parse();
+}
+
 } // namespace partial
 
 //! @brief Decode JSON formatted data into dynamic variable.
@@ -52,7 +87,70 @@ template <typename U, template <typename> class Allocator = std::allocator>
 auto parse(const U& input) -> dynamic::basic_variable<Allocator>
 {
     json::reader reader(input);
-    auto result = partial::parse(reader);
+    auto result = partial::parse<Allocator>(reader);
+    if (reader.symbol() != json::token::symbol::end)
+        throw json::error(json::unexpected_token);
+    return result;
+}
+
+//! @brief Decode JSON formatted data in a mutable buffer into dynamic variable.
+//!
+//! Same as parse(const U&) except that escaped strings are unescaped within
+//! the input buffer instead of in a separate buffer. The original content of
+//! the buffer is destroyed.
+//!
+//! @param buffer The mutable JSON formatted input buffer.
+//! @param size The number of characters in the buffer.
+//! @returns Dynamic variable containing the decoded JSON data.
+
+template <template <typename> class Allocator = std::allocator>
+auto parse(json::in_situ_t,
+           char *buffer,
+           std::size_t size) -> dynamic::basic_variable<Allocator>
+{
+    json::reader reader(json::in_situ, buffer, size);
+    auto result = partial::parse<Allocator>(reader);
+    if (reader.symbol() != json::token::symbol::end)
+        throw json::error(json::unexpected_token);
+    return result;
+}
+
+//! @brief Decode JSON formatted data into arena-allocated dynamic variable.
+//!
+//! The nodes of the returned variable are allocated from @c memory, so the
+//! individual deallocations are skipped when the variable is destroyed, and
+//! the memory is reclaimed at once when the arena is released.
+//!
+//! @param input The JSON formatted input buffer.
+//! @param memory Arena that must outlive the returned variable.
+//! @returns Dynamic variable containing the decoded JSON data.
+
+template <typename U>
+auto parse(const U& input,
+           core::arena& memory) -> dynamic::basic_variable<core::arena_allocator>
+{
+    core::arena::scope scope(memory);
+    return json::parse<U, core::arena_allocator>(input);
+}
+
+//! @brief Decode JSON formatted data into dynamic variable with interned keys.
+//!
+//! The keys of objects are obtained from @c pool, so the keys of repeated
+//! records are stored once. The pool can be reused for several documents.
+//!
+//! Decoding with json::parse<U, dynamic::interned_allocator>(input) interns
+//! keys with a pool that is local to the call.
+//!
+//! @param input The JSON formatted input buffer.
+//! @param pool Pool of interned keys.
+//! @returns Dynamic variable containing the decoded JSON data.
+
+template <typename U>
+auto parse(const U& input,
+           dynamic::string_pool& pool) -> dynamic::interned_variable
+{
+    json::reader reader(input);
+    auto result = partial::parse(reader, pool);
     if (reader.symbol() != json::token::symbol::end)
         throw json::error(json::unexpected_token);
     return result;
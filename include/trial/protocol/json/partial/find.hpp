@@ -0,0 +1,306 @@
+#ifndef TRIAL_PROTOCOL_JSON_PARTIAL_FIND_HPP
+#define TRIAL_PROTOCOL_JSON_PARTIAL_FIND_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef> // std::size_t
+#include <string>
+#include <system_error>
+#include <vector>
+#include <trial/protocol/json/error.hpp>
+#include <trial/protocol/json/reader.hpp>
+#include <trial/protocol/json/detail/path.hpp>
+#include <trial/protocol/json/partial/skip.hpp>
+
+namespace trial
+{
+namespace protocol
+{
+namespace json
+{
+namespace detail
+{
+
+// Move reader from begin object to the value of the given key.
+template <typename CharT, std::size_t N>
+bool find_key(basic_reader<CharT, N>& reader,
+              const std::basic_string<CharT>& key,
+              std::basic_string<CharT>& scratch,
+              std::error_code& ec)
+{
+    using view_type = typename basic_reader<CharT, N>::view_type;
+
+    reader.next();
+    while (reader.symbol() == token::symbol::string)
+    {
+        const bool match = (reader.string_view(scratch) == view_type(key.data(), key.size()));
+        if (!reader.next())
+            break;
+        if (match)
+            return true;
+        partial::skip(reader, ec);
+        if (ec)
+            return false;
+    }
+    if (reader.symbol() == token::symbol::error)
+        ec = reader.error();
+    return false;
+}
+
+// Move reader from begin array to the element at the given position.
+template <typename CharT, std::size_t N>
+bool find_index(basic_reader<CharT, N>& reader,
+                std::size_t position,
+                std::error_code& ec)
+{
+    reader.next();
+    for (std::size_t index = 0; ; ++index)
+    {
+        switch (reader.symbol())
+        {
+        case token::symbol::end_array:
+            return false;
+
+        case token::symbol::error:
+            ec = reader.error();
+            return false;
+
+        default:
+            break;
+        }
+        if (index == position)
+            return true;
+        partial::skip(reader, ec);
+        if (ec)
+            return false;
+    }
+}
+
+// Consume one value and collect those that match the remaining segments.
+template <typename CharT, std::size_t N>
+void select_value(basic_reader<CharT, N>& reader,
+                  const std::vector<path_segment<CharT>>& segments,
+                  std::size_t current,
+                  std::vector<typename basic_reader<CharT, N>::view_type>& result,
+                  std::basic_string<CharT>& scratch,
+                  std::error_code& ec)
+{
+    using view_type = typename basic_reader<CharT, N>::view_type;
+    using segment_type = path_segment<CharT>;
+
+    if (current == segments.size())
+    {
+        auto view = partial::skip(reader, ec);
+        if (!ec)
+            result.push_back(view);
+        return;
+    }
+
+    const auto& segment = segments[current];
+    switch (reader.symbol())
+    {
+    case token::symbol::begin_object:
+        if (segment.kind == segment_type::index)
+            break;
+        reader.next();
+        while (reader.symbol() == token::symbol::string)
+        {
+            const bool match = (segment.kind == segment_type::wildcard) ||
+                (reader.string_view(scratch) == view_type(segment.name.data(), segment.name.size()));
+            if (!reader.next())
+                break;
+            if (match)
+                select_value(reader, segments, current + 1, result, scratch, ec);
+            else
+                partial::skip(reader, ec);
+            if (ec)
+                return;
+        }
+        if (reader.symbol() != token::symbol::end_object)
+        {
+            ec = reader.error();
+            return;
+        }
+        reader.next();
+        if (reader.symbol() == token::symbol::error)
+            ec = reader.error();
+        return;
+
+    case token::symbol::begin_array:
+        if (segment.kind == segment_type::key)
+            break;
+        reader.next();
+        for (std::size_t index = 0; ; ++index)
+        {
+            switch (reader.symbol())
+            {
+            case token::symbol::end_array:
+                reader.next();
+                if (reader.symbol() == token::symbol::error)
+                    ec = reader.error();
+                return;
+
+            case token::symbol::error:
+                ec = reader.error();
+                return;
+
+            default:
+                break;
+            }
+            if ((segment.kind == segment_type::wildcard) || (index == segment.position))
+                select_value(reader, segments, current + 1, result, scratch, ec);
+            else
+                partial::skip(reader, ec);
+            if (ec)
+                return;
+        }
+
+    case token::symbol::error:
+        ec = reader.error();
+        return;
+
+    default:
+        break;
+    }
+    // Value cannot match the remaining segments
+    partial::skip(reader, ec);
+}
+
+} // namespace detail
+
+namespace partial
+{
+
+//! @brief Find a value by JSON Pointer (RFC 6901).
+//!
+//! Starts at the current value of @c reader, and moves through the input by
+//! skipping all values that are not on the path of the pointer. No values are
+//! decoded apart from the keys that are compared.
+//!
+//! @param[in,out] reader Reader positioned at the start of a value. If found,
+//!                the reader is positioned at the referenced value. Otherwise
+//!                the position of the reader is unspecified.
+//! @param[in] pointer JSON Pointer, such as "/alpha/0".
+//! @param[out] ec Set to json::invalid_path if the pointer is malformed, or
+//!             to the reader error if the input is malformed.
+//! @returns true if the value was found, false otherwise.
+template <typename CharT, std::size_t N>
+bool find(basic_reader<CharT, N>& reader,
+          const typename basic_reader<CharT, N>::view_type& pointer,
+          std::error_code& ec)
+{
+    std::vector<std::basic_string<CharT>> tokens;
+    if (!json::detail::parse_pointer(pointer, tokens))
+    {
+        ec = errc::invalid_path;
+        return false;
+    }
+
+    std::basic_string<CharT> scratch;
+    for (const auto& reference : tokens)
+    {
+        switch (reader.symbol())
+        {
+        case token::symbol::begin_object:
+            if (!json::detail::find_key(reader, reference, scratch, ec))
+                return false;
+            break;
+
+        case token::symbol::begin_array:
+            {
+                std::size_t position;
+                if (!json::detail::to_index(reference, position))
+                    return false;
+                if (!json::detail::find_index(reader, position, ec))
+                    return false;
+            }
+            break;
+
+        case token::symbol::error:
+            ec = reader.error();
+            return false;
+
+        default:
+            return false;
+        }
+    }
+    return reader.symbol() != token::symbol::error;
+}
+
+//! @brief Find a value by JSON Pointer (RFC 6901).
+//!
+//! @throws json::error If the pointer or the input is malformed.
+//! @sa find(basic_reader<CharT, N>&, const view_type&, std::error_code&)
+template <typename CharT, std::size_t N>
+bool find(basic_reader<CharT, N>& reader,
+          const typename basic_reader<CharT, N>::view_type& pointer)
+{
+    std::error_code ec;
+    const bool result = find(reader, pointer, ec);
+    if (ec)
+        throw json::error(ec);
+    return result;
+}
+
+//! @brief Select values by JSONPath expression.
+//!
+//! The following subset of JSONPath is supported: the root "$", members
+//! ".name" and "['name']", array elements "[n]", and wildcards ".*" and "[*]".
+//!
+//! The current value of @c reader is consumed. Values that are not on the
+//! path are skipped without being decoded.
+//!
+//! @param[in,out] reader Reader positioned at the start of a value.
+//! @param[in] path JSONPath expression, such as "$.alpha[*].bravo".
+//! @param[out] ec Set to json::invalid_path if the path is malformed, or to
+//!             the reader error if the input is malformed.
+//! @returns Views of the raw input of the matching values in document order.
+template <typename CharT, std::size_t N>
+std::vector<typename basic_reader<CharT, N>::view_type>
+select(basic_reader<CharT, N>& reader,
+       const typename basic_reader<CharT, N>::view_type& path,
+       std::error_code& ec)
+{
+    std::vector<typename basic_reader<CharT, N>::view_type> result;
+    std::vector<json::detail::path_segment<CharT>> segments;
+    if (!json::detail::parse_path(path, segments))
+    {
+        ec = errc::invalid_path;
+        return result;
+    }
+
+    std::basic_string<CharT> scratch;
+    json::detail::select_value(reader, segments, 0, result, scratch, ec);
+    return result;
+}
+
+//! @brief Select values by JSONPath expression.
+//!
+//! @throws json::error If the path or the input is malformed.
+//! @sa select(basic_reader<CharT, N>&, const view_type&, std::error_code&)
+template <typename CharT, std::size_t N>
+std::vector<typename basic_reader<CharT, N>::view_type>
+select(basic_reader<CharT, N>& reader,
+       const typename basic_reader<CharT, N>::view_type& path)
+{
+    std::error_code ec;
+    auto result = select(reader, path, ec);
+    if (ec)
+        throw json::error(ec);
+    return result;
+}
+
+} // namespace partial
+} // namespace json
+} // namespace protocol
+} // namespace trial
+
+#endif // TRIAL_PROTOCOL_JSON_PARTIAL_FIND_HPP
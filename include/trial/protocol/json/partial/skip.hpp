@@ -12,6 +12,8 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <trial/protocol/json/reader.hpp>
+#include <trial/protocol/json/detail/scan.hpp>
+#include <trial/protocol/json/partial/skip_index.hpp>
 
 namespace trial
 {
@@ -22,11 +24,11 @@ namespace json
 namespace partial
 {
 
-template<class CharT>
-typename basic_reader<CharT>::view_type
-skip(basic_reader<CharT> &reader, std::error_code &ec)
+template<class CharT, std::size_t N>
+typename basic_reader<CharT, N>::view_type
+skip(basic_reader<CharT, N> &reader, std::error_code &ec)
 {
-    using view_type = typename basic_reader<CharT>::view_type;
+    using view_type = typename basic_reader<CharT, N>::view_type;
     using size_type = typename view_type::size_type;
 
     switch (reader.symbol()) {
@@ -69,9 +71,9 @@ skip(basic_reader<CharT> &reader, std::error_code &ec)
     return {};
 }
 
-template<class CharT>
-typename basic_reader<CharT>::view_type
-skip(basic_reader<CharT> &reader)
+template<class CharT, std::size_t N>
+typename basic_reader<CharT, N>::view_type
+skip(basic_reader<CharT, N> &reader)
 {
     std::error_code ec;
     auto ret = skip(reader, ec);
@@ -80,6 +82,93 @@ skip(basic_reader<CharT> &reader)
     return ret;
 }
 
+//! @brief Skip the current value using a precomputed index.
+//!
+//! Containers found in the index are skipped in constant time without
+//! validating their content. Other values are skipped as with skip().
+template<class CharT, std::size_t N>
+typename basic_reader<CharT, N>::view_type
+skip(basic_reader<CharT, N> &reader,
+     const basic_skip_index<CharT> &index,
+     std::error_code &ec)
+{
+    using view_type = typename basic_reader<CharT, N>::view_type;
+    using size_type = typename view_type::size_type;
+
+    switch (reader.symbol()) {
+    case token::symbol::begin_array:
+    case token::symbol::begin_object:
+        {
+            auto ret_begin = reader.literal().data();
+            auto ret_end = index.find(ret_begin);
+            if (!ret_end)
+                break;
+            if (!reader.skip_container(ret_end))
+                ec = reader.error();
+            return {ret_begin, static_cast<size_type>(ret_end + 1 - ret_begin)};
+        }
+    default:
+        break;
+    }
+    return skip(reader, ec);
+}
+
+template<class CharT, std::size_t N>
+typename basic_reader<CharT, N>::view_type
+skip(basic_reader<CharT, N> &reader,
+     const basic_skip_index<CharT> &index)
+{
+    std::error_code ec;
+    auto ret = skip(reader, index, ec);
+    if (ec)
+        throw std::system_error(ec);
+    return ret;
+}
+
+//! @brief Skip the current value without tokenizing containers.
+//!
+//! Containers are skipped by scanning for string delimiters, brackets, and
+//! braces, so their content is not validated. Other values are skipped as
+//! with skip().
+template<class CharT, std::size_t N>
+typename basic_reader<CharT, N>::view_type
+skip_unchecked(basic_reader<CharT, N> &reader, std::error_code &ec)
+{
+    using view_type = typename basic_reader<CharT, N>::view_type;
+    using size_type = typename view_type::size_type;
+
+    switch (reader.symbol()) {
+    case token::symbol::begin_array:
+    case token::symbol::begin_object:
+        {
+            auto ret_begin = reader.literal().data();
+            const auto& tail = reader.tail();
+            auto last = tail.data() + tail.size();
+            auto ret_end = json::detail::find_container_end(ret_begin, last);
+            if (ret_end == last) {
+                ec = errc::insufficient_tokens;
+                return {};
+            }
+            if (!reader.skip_container(ret_end))
+                ec = reader.error();
+            return {ret_begin, static_cast<size_type>(ret_end + 1 - ret_begin)};
+        }
+    default:
+        return skip(reader, ec);
+    }
+}
+
+template<class CharT, std::size_t N>
+typename basic_reader<CharT, N>::view_type
+skip_unchecked(basic_reader<CharT, N> &reader)
+{
+    std::error_code ec;
+    auto ret = skip_unchecked(reader, ec);
+    if (ec)
+        throw std::system_error(ec);
+    return ret;
+}
+
 } // namespace partial
 } // namespace json
 } // namespace protocol
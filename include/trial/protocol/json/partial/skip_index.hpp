@@ -0,0 +1,146 @@
+#ifndef TRIAL_PROTOCOL_JSON_PARTIAL_SKIP_INDEX_HPP
+#define TRIAL_PROTOCOL_JSON_PARTIAL_SKIP_INDEX_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef> // std::size_t
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include <boost/config.hpp>
+#include <trial/protocol/core/detail/simd.hpp>
+#include <trial/protocol/core/detail/small_stack.hpp>
+#include <trial/protocol/json/reader.hpp>
+#include <trial/protocol/json/detail/scan.hpp>
+
+namespace trial
+{
+namespace protocol
+{
+namespace json
+{
+namespace partial
+{
+
+//! @brief Index of matching container ends in a JSON formatted buffer.
+//!
+//! The index is built by a single scan over the input that only looks at
+//! string delimiters, brackets, and braces. Afterwards the end of any
+//! container in the buffer can be looked up in constant time, which lets
+//! partial::skip() jump over containers instead of parsing them.
+//!
+//! The positions of the opening characters are stored in a bitmap with a
+//! running count per word, so a position is mapped to the ordinal number of
+//! its container with a single population count.
+//!
+//! The index does not assume ownership of the input buffer.
+template <typename CharT>
+class basic_skip_index
+{
+public:
+    using value_type = typename basic_reader<CharT>::value_type;
+    using size_type = typename basic_reader<CharT>::size_type;
+    using view_type = typename basic_reader<CharT>::view_type;
+
+    //! @brief Build index for input buffer.
+    //!
+    //! @param[in] input A string view of a JSON formatted buffer.
+    explicit basic_skip_index(const view_type& input)
+        : input(input),
+          bits((input.size() + word_size - 1) / word_size, 0),
+          counts(bits.size(), 0)
+    {
+        const value_type *first = input.data();
+        const value_type *last = first + input.size();
+        // Ordinal numbers of unterminated containers
+        core::detail::small_stack<size_type, 32> scope;
+
+        const value_type *current = first;
+        while (true)
+        {
+            current = json::detail::scanner<CharT>::find_structural(current, last);
+            if (current == last)
+                break;
+            const size_type offset = size_type(current - first);
+            switch (*current)
+            {
+            case json::detail::traits<CharT>::alpha_quote:
+                current = json::detail::find_string_end(current + 1, last);
+                break;
+
+            case json::detail::traits<CharT>::alpha_bracket_open:
+            case json::detail::traits<CharT>::alpha_brace_open:
+                bits[offset / word_size] |= std::uint64_t(1) << (offset % word_size);
+                scope.push(ends.size());
+                ends.push_back(size_type(npos));
+                break;
+
+            default:
+                if (!scope.empty())
+                {
+                    ends[scope.top()] = offset;
+                    scope.pop();
+                }
+                break;
+            }
+            if (current == last)
+                break;
+            ++current;
+        }
+
+        size_type total = 0;
+        for (size_type word = 0; word < bits.size(); ++word)
+        {
+            counts[word] = total;
+            total += core::detail::simd::count_ones(bits[word]);
+        }
+    }
+
+    //! @brief Find the end of a container.
+    //!
+    //! @param[in] position Position of the opening bracket or brace.
+    //! @returns Position of the matching closing bracket or brace, or nullptr
+    //!          if position does not start a terminated container.
+    const value_type *find(const value_type *position) const BOOST_NOEXCEPT
+    {
+        if ((position < input.data()) || (position >= input.data() + input.size()))
+            return nullptr;
+
+        const size_type offset = size_type(position - input.data());
+        const std::uint64_t word = bits[offset / word_size];
+        const std::uint64_t bit = std::uint64_t(1) << (offset % word_size);
+        if ((word & bit) == 0)
+            return nullptr;
+
+        const size_type end = ends[counts[offset / word_size] + core::detail::simd::count_ones(word & (bit - 1))];
+        return (end == npos) ? nullptr : input.data() + end;
+    }
+
+#ifndef BOOST_DOXYGEN_INVOKED
+private:
+    static const size_type word_size = 64;
+    static const size_type npos = std::numeric_limits<size_type>::max();
+
+    view_type input;
+    std::vector<std::uint64_t> bits;
+    std::vector<size_type> counts;
+    std::vector<size_type> ends;
+#endif
+};
+
+using skip_index = basic_skip_index<char>;
+
+} // namespace partial
+} // namespace json
+} // namespace protocol
+} // namespace trial
+
+#endif // TRIAL_PROTOCOL_JSON_PARTIAL_SKIP_INDEX_HPP
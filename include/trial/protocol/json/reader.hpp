@@ -11,9 +11,11 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <cstddef> // std::size_t
+#include <limits>
 #include <string>
-#include <stack>
 #include <boost/config.hpp>
+#include <trial/protocol/core/detail/small_stack.hpp>
 #include <trial/protocol/json/error.hpp>
 #include <trial/protocol/json/token.hpp>
 #include <trial/protocol/json/detail/decoder.hpp>
@@ -25,13 +27,25 @@ namespace protocol
 namespace json
 {
 
+//! @brief Tag type for in-situ decoding.
+struct in_situ_t {};
+
+//! @brief Tag that selects in-situ decoding of a mutable input buffer.
+BOOST_CONSTEXPR_OR_CONST in_situ_t in_situ = in_situ_t();
+
+template <typename CharT> class basic_stream_reader;
+template <typename CharT> class basic_tape;
+
 //! @brief Incremental JSON reader.
 //!
 //! Parse a JSON formatted input buffer incrementally. Incrementally means that
 //! the reader only parses enough of the input to identify the next token.
 //! The entire input has to be parsed by repeating parsing the next token until
 //! the end of the input.
-template <typename CharT>
+//!
+//! The nesting state for the first N levels is stored inside the reader, so
+//! only deeper nesting allocates memory.
+template <typename CharT, std::size_t N = 32>
 class basic_reader
 {
 public:
@@ -46,7 +60,31 @@ public:
     //! The reader does not assume ownership of the view.
     //!
     //! @param[in] view A string view of a JSON formatted buffer.
-    basic_reader(const view_type& view);
+    //! @param[in] max_level Maximum nesting level. Deeper nesting results in
+    //!            the json::nesting_limit error. A limit of at most N ensures
+    //!            that the reader never allocates memory.
+    basic_reader(const view_type& view,
+                 size_type max_level = std::numeric_limits<size_type>::max());
+
+    //! @brief Construct an incremental JSON reader that decodes in situ.
+    //!
+    //! Same as the view constructor, except that escaped string tokens are
+    //! unescaped within the input buffer when their value is requested, so
+    //! string_view() returns a view into the input buffer without using the
+    //! scratch buffer. The original content of the buffer is destroyed.
+    //!
+    //! Once a string token has been unescaped, literal() still spans the
+    //! original token, but its characters are no longer valid JSON.
+    //!
+    //! The reader does not assume ownership of the buffer.
+    //!
+    //! @param[in,out] buffer A mutable JSON formatted buffer.
+    //! @param[in] size The number of characters in the buffer.
+    //! @param[in] max_level Maximum nesting level.
+    basic_reader(in_situ_t,
+                 value_type *buffer,
+                 size_type size,
+                 size_type max_level = std::numeric_limits<size_type>::max());
 
     //! @brief Copy-construct an incremental JSON reader.
     //!
@@ -67,6 +105,18 @@ public:
     //! @returns false if current token does not have the expected value.
     bool next(token::code::value expect);
 
+    //! @brief Move past the current container without tokenizing its content.
+    //!
+    //! The content of the container is only scanned for string delimiters,
+    //! brackets, and braces, so it is not validated. If the current token is
+    //! not the beginning of a container, then this is the same as next().
+    //!
+    //! @param[in] end Position of the matching end bracket or brace in the
+    //!            input buffer, if known in advance. Otherwise the input is
+    //!            scanned for it.
+    //! @returns false if an error occurred or end-of-input was reached, true otherwise.
+    bool skip_container(const value_type *end = nullptr);
+
     //! @brief Get the current nesting level.
     //!
     //! Keep track of the nesting level of containers.
@@ -110,6 +160,19 @@ public:
     //! @throws json::error If requested type is incompatible with the current token.
     template <typename ReturnType> ReturnType value() const;
 
+    //! @brief Get the current string token without allocating a new string.
+    //!
+    //! Strings without escaped characters are returned as a view into the
+    //! input buffer. Otherwise the unescaped string is stored in the scratch
+    //! buffer, which is returned as a view. Reusing the scratch buffer avoids
+    //! allocations once it has grown large enough.
+    //!
+    //! @param[in,out] scratch Storage for unescaped strings.
+    //! @returns A view of the unquoted and unescaped string. The view is valid
+    //!          until the input buffer or the scratch buffer is modified.
+    //! @throws json::error If the current token is not a string.
+    view_type string_view(std::basic_string<value_type>& scratch) const;
+
     //! @returns A view of the current value before it is converted into its type.
     const view_type& literal() const BOOST_NOEXCEPT;
 
@@ -126,12 +189,19 @@ private:
     template <typename ReturnType> ReturnType real_value() const;
     template <typename ReturnType> ReturnType string_value() const;
 
+    template <typename> friend class basic_stream_reader;
+    template <typename> friend class basic_tape;
+
+    // Reader positioned at a token that has already been scanned
+    explicit basic_reader(const detail::basic_decoder<value_type>&);
+
 private:
     using decoder_type = detail::basic_decoder<value_type>;
     mutable decoder_type decoder;
 
     struct frame
     {
+        frame() = default;
         frame(token::detail::code::value);
 
         bool is_array() const;
@@ -145,7 +215,8 @@ private:
         token::detail::code::value scope;
         size_type counter;
     };
-    std::stack<frame> stack;
+    core::detail::small_stack<frame, N> stack;
+    size_type max_level;
 #endif
 };
 
@@ -0,0 +1,41 @@
+#ifndef TRIAL_PROTOCOL_JSON_REAL_FORMAT_HPP
+#define TRIAL_PROTOCOL_JSON_REAL_FORMAT_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+namespace trial
+{
+namespace protocol
+{
+namespace json
+{
+
+//! @brief Output format of floating-point numbers.
+enum class real_format
+{
+    //! @brief Fixed number of significant digits.
+    //!
+    //! Numbers are written with std::numeric_limits<T>::digits10 significant
+    //! digits, which may not convert back to the same value.
+    fixed_precision,
+
+    //! @brief Short representation that converts back to the same value.
+    //!
+    //! Digits are generated with Grisu2. The output always converts back to
+    //! the same value, but it is not always the shortest such representation.
+    shortest
+};
+
+} // namespace json
+} // namespace protocol
+} // namespace trial
+
+#endif // TRIAL_PROTOCOL_JSON_REAL_FORMAT_HPP
@@ -177,11 +177,12 @@ struct load_overloader< protocol::json::basic_iarchive<CharT>,
             {
                 ar.template load<token::begin_array>();
                 data = dynamic::array::make();
+                auto& items = data.assume_value<dynamic::variable::array_type>();
                 while (!ar.template at<token::end_array>())
                 {
                     dynamic::variable value;
                     ar.load_override(value);
-                    data.insert(data.end(), value);
+                    items.push_back(std::move(value));
                 }
                 ar.template load<token::end_array>();
             }
@@ -191,13 +192,14 @@ struct load_overloader< protocol::json::basic_iarchive<CharT>,
             {
                 ar.template load<token::begin_object>();
                 data = dynamic::map::make();
+                auto& members = data.assume_value<dynamic::variable::map_type>();
                 while (!ar.template at<token::end_object>())
                 {
                     std::string key;
                     ar.load_override(key);
                     dynamic::variable value;
                     ar.load_override(value);
-                    data.insert(data.end(), { std::move(key), std::move(value) });
+                    members.emplace(std::move(key), std::move(value));
                 }
                 ar.template load<token::end_object>();
             }
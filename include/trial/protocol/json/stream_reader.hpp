@@ -0,0 +1,145 @@
+#ifndef TRIAL_PROTOCOL_JSON_STREAM_READER_HPP
+#define TRIAL_PROTOCOL_JSON_STREAM_READER_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <system_error>
+#include <boost/config.hpp>
+#include <trial/protocol/json/reader.hpp>
+
+namespace trial
+{
+namespace protocol
+{
+namespace json
+{
+
+//! @brief Incremental JSON reader for input that arrives in chunks.
+//!
+//! Input is appended chunk by chunk. When the next token is not entirely
+//! contained in the received input, the reader keeps its current position and
+//! reports that it needs more input. Parsing resumes when the next chunk has
+//! been appended.
+//!
+//! Consumed input is discarded when a new chunk is appended, so the internal
+//! buffer only holds the current token and the unparsed input.
+//!
+//! The stream reader is not a basic_reader, because functions that take a
+//! basic_reader would parse incomplete tokens as if the input had ended. The
+//! current token is accessed with the same member functions as in basic_reader.
+template <typename CharT>
+class basic_stream_reader
+{
+    using reader_type = basic_reader<CharT>;
+
+public:
+    using value_type = typename reader_type::value_type;
+    using size_type = typename reader_type::size_type;
+    using view_type = typename reader_type::view_type;
+
+    //! @brief Construct a chunked JSON reader without input.
+    //!
+    //! The first token is parsed by the first call to next().
+    basic_stream_reader();
+
+    basic_stream_reader(const basic_stream_reader&) = delete;
+    basic_stream_reader& operator=(const basic_stream_reader&) = delete;
+
+    //! @brief Append a chunk of input.
+    //!
+    //! The chunk is copied so its storage can be reused afterwards.
+    //!
+    //! Views obtained from the reader are invalidated.
+    //!
+    //! @param[in] chunk The next part of the JSON formatted input.
+    void append(const view_type& chunk);
+
+    //! @brief Mark the end of input.
+    //!
+    //! Subsequent tokens are parsed as in basic_reader, so incomplete tokens
+    //! are reported as errors.
+    void finish() BOOST_NOEXCEPT;
+
+    //! @brief Parse the next token.
+    //!
+    //! If the next token is incomplete, the current token is retained and
+    //! needs_input() returns true.
+    //!
+    //! @returns false if an error occurred, end-of-input was reached, or more
+    //!          input is needed, true otherwise.
+    bool next();
+
+    //! @brief Parse the next token if current token has a given value.
+    //!
+    //! @param[in] expect Expected value of current token.
+    //! @returns false if current token does not have the expected value.
+    bool next(token::code::value expect);
+
+    //! @returns true if the last call to next() needs more input to proceed.
+    bool needs_input() const BOOST_NOEXCEPT;
+
+    //! @returns The current nesting level.
+    size_type level() const BOOST_NOEXCEPT;
+
+    //! @returns The code of the current token.
+    token::code::value code() const BOOST_NOEXCEPT;
+
+    //! @returns The symbol of the current token.
+    token::symbol::value symbol() const BOOST_NOEXCEPT;
+
+    //! @returns The category of the current token.
+    token::category::value category() const BOOST_NOEXCEPT;
+
+    //! @returns The current error code.
+    std::error_code error() const BOOST_NOEXCEPT;
+
+    //! @brief Converts the current value into ReturnType.
+    //!
+    //! @throws json::error If requested type is incompatible with the current token.
+    template <typename ReturnType> ReturnType value() const;
+
+    //! @brief Get the current string token without allocating a new string.
+    //!
+    //! @throws json::error If the current token is not a string.
+    view_type string_view(std::basic_string<value_type>& scratch) const;
+
+    //! @returns A view of the current value before it is converted into its type.
+    const view_type& literal() const BOOST_NOEXCEPT;
+
+    //! @returns A view of the remaining buffer.
+    const view_type& tail() const BOOST_NOEXCEPT;
+
+#ifndef BOOST_DOXYGEN_INVOKED
+private:
+    bool is_incomplete() const BOOST_NOEXCEPT;
+    size_type offset(const view_type&) const BOOST_NOEXCEPT;
+
+private:
+    using decoder_type = typename reader_type::decoder_type;
+    using frame = typename reader_type::frame;
+
+    std::basic_string<value_type> buffer;
+    reader_type reader;
+    bool is_finished;
+    bool is_waiting;
+#endif
+};
+
+using stream_reader = basic_stream_reader<char>;
+
+} // namespace json
+} // namespace protocol
+} // namespace trial
+
+#include <trial/protocol/json/detail/stream_reader.ipp>
+
+#endif // TRIAL_PROTOCOL_JSON_STREAM_READER_HPP
@@ -0,0 +1,163 @@
+#ifndef TRIAL_PROTOCOL_JSON_TAPE_HPP
+#define TRIAL_PROTOCOL_JSON_TAPE_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef> // std::size_t
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <boost/config.hpp>
+#include <trial/protocol/json/reader.hpp>
+
+namespace trial
+{
+namespace protocol
+{
+namespace json
+{
+
+//! @brief Flat token index of a JSON formatted buffer.
+//!
+//! The entire input is parsed and validated once, and the tokens are stored
+//! in a single contiguous tape. Each entry refers to the input buffer, so the
+//! tape does not assume ownership of the input, which must outlive the tape.
+//!
+//! Containers store the position of their matching end token, so a cursor
+//! can skip over a container in constant time.
+//!
+//! Each entry occupies 16 bytes and positions are stored as 32-bit integers,
+//! so the input is limited to 4 GiB. The number of tokens is bounded by a
+//! counting pass over the delimiters before parsing, so the tape is filled
+//! in a single allocation proportional to the number of tokens.
+template <typename CharT>
+class basic_tape
+{
+public:
+    using value_type = typename basic_reader<CharT>::value_type;
+    using size_type = typename basic_reader<CharT>::size_type;
+    using view_type = typename basic_reader<CharT>::view_type;
+
+    class cursor;
+
+    //! @brief Parse JSON formatted input into a tape.
+    //!
+    //! @param[in] input A string view of a JSON formatted buffer.
+    //! @throws json::error If the input is not valid JSON.
+    //! @throws std::length_error If the input is 4 GiB or larger.
+    explicit basic_tape(const view_type& input);
+
+    //! @returns The number of tokens, including the final end token.
+    size_type size() const BOOST_NOEXCEPT;
+
+    //! @returns A cursor positioned at the first token.
+    cursor begin() const BOOST_NOEXCEPT;
+
+#ifndef BOOST_DOXYGEN_INVOKED
+private:
+    using index_type = std::uint32_t;
+
+    static size_type count_tokens(const view_type&) BOOST_NOEXCEPT;
+
+    struct entry
+    {
+        index_type offset;
+        index_type length;
+        // Position of matching begin or end token for containers
+        index_type partner;
+        std::uint8_t code;
+        // String token contains escaped characters
+        bool escaped;
+    };
+
+    view_type input;
+    std::vector<entry> entries;
+#endif
+};
+
+//! @brief Iteration over the tokens of a tape.
+//!
+//! The cursor has the same accessors as basic_reader, so code that walks a
+//! reader can walk a tape as well.
+template <typename CharT>
+class basic_tape<CharT>::cursor
+{
+public:
+    //! @brief Move to the next token.
+    //!
+    //! @returns false if end-of-input was reached, true otherwise.
+    bool next() BOOST_NOEXCEPT;
+
+    //! @brief Move past the current value.
+    //!
+    //! If the current token starts a container, then the entire container is
+    //! skipped in constant time. Otherwise this is the same as next().
+    //!
+    //! @returns false if end-of-input was reached, true otherwise.
+    bool skip() BOOST_NOEXCEPT;
+
+    //! @brief Get the current nesting level.
+    //!
+    //! Follows the same convention as basic_reader::level().
+    //!
+    //! @returns The current nesting level.
+    size_type level() const BOOST_NOEXCEPT;
+
+    //! @returns The position of the current token in the tape.
+    size_type position() const BOOST_NOEXCEPT;
+
+    //! @returns The code of the current token.
+    token::code::value code() const BOOST_NOEXCEPT;
+
+    //! @returns The symbol of the current token.
+    token::symbol::value symbol() const BOOST_NOEXCEPT;
+
+    //! @returns The category of the current token.
+    token::category::value category() const BOOST_NOEXCEPT;
+
+    //! @brief Converts the current value into ReturnType.
+    //!
+    //! The same conversions as basic_reader::value() are valid.
+    //!
+    //! @returns The converted value.
+    //! @throws json::error If requested type is incompatible with the current token.
+    template <typename ReturnType> ReturnType value() const;
+
+    //! @brief Get the current string token without allocating a new string.
+    //!
+    //! @sa basic_reader::string_view()
+    view_type string_view(std::basic_string<value_type>& scratch) const;
+
+    //! @returns A view of the current value before it is converted into its type.
+    view_type literal() const BOOST_NOEXCEPT;
+
+#ifndef BOOST_DOXYGEN_INVOKED
+private:
+    friend class basic_tape<CharT>;
+
+    cursor(const basic_tape<CharT>& tape) BOOST_NOEXCEPT;
+    detail::basic_decoder<CharT> token_decoder() const BOOST_NOEXCEPT;
+
+    const basic_tape<CharT> *tape;
+    size_type current;
+    size_type depth;
+#endif
+};
+
+using tape = basic_tape<char>;
+
+} // namespace json
+} // namespace protocol
+} // namespace trial
+
+#include <trial/protocol/json/detail/tape.ipp>
+
+#endif // TRIAL_PROTOCOL_JSON_TAPE_HPP
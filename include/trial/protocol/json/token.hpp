@@ -41,6 +41,7 @@ struct code
         error_unbalanced_end_object,
         error_expected_end_array,
         error_expected_end_object,
+        error_nesting_limit,
 
         null,
         true_value,
@@ -74,6 +75,7 @@ struct code
         error_unbalanced_end_object = detail::code::error_unbalanced_end_object,
         error_expected_end_array = detail::code::error_expected_end_array,
         error_expected_end_object = detail::code::error_expected_end_object,
+        error_nesting_limit = detail::code::error_nesting_limit,
 
         null = detail::code::null,
         true_value = detail::code::true_value,
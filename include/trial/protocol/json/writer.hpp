@@ -15,6 +15,7 @@
 #include <trial/protocol/buffer/base.hpp>
 #include <trial/protocol/json/error.hpp>
 #include <trial/protocol/json/token.hpp>
+#include <trial/protocol/json/real_format.hpp>
 #include <trial/protocol/json/detail/encoder.hpp>
 
 namespace trial
@@ -27,20 +28,28 @@ namespace json
 //! @brief Incremental JSON writer.
 //!
 //! Generate JSON output incrementally by appending C++ data.
-template <typename CharT, std::size_t N = 2 * sizeof(void *)>
+//!
+//! By default the output buffer is type-erased, so any buffer that fits into
+//! N bytes can be used. If OutputType is given, then the writer only accepts
+//! that type of buffer, but writes directly into it without virtual dispatch.
+template <typename CharT,
+          std::size_t N = 2 * sizeof(void *),
+          typename OutputType = void>
 class basic_writer
 {
 public:
     using value_type = CharT;
     using size_type = std::size_t;
-    using view_type = typename detail::basic_encoder<value_type, N>::view_type;
+    using view_type = typename detail::basic_encoder<value_type, N, OutputType>::view_type;
 
     //! @brief Construct an incremental JSON writer.
     //!
     //! The buffer type can be any for which a buffer wrapper exists.
     //!
     //! @param[in] buffer A buffer where the JSON formatted output is stored.
-    template <typename T> basic_writer(T& buffer);
+    //! @param[in] format Output format of floating-point numbers.
+    template <typename T> basic_writer(T& buffer,
+                                       json::real_format format = json::real_format::fixed_precision);
 
     std::error_code error() const BOOST_NOEXCEPT;
     size_type level() const BOOST_NOEXCEPT;
@@ -71,7 +80,7 @@ private:
     size_type end_object_value();
 
 private:
-    using encoder_type = detail::basic_encoder<value_type, N>;
+    using encoder_type = detail::basic_encoder<value_type, N, OutputType>;
     encoder_type encoder;
     mutable enum json::errc last_error;
 
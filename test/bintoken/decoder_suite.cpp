@@ -13,6 +13,7 @@
 #include <functional>
 #include <trial/protocol/buffer/array.hpp>
 #include <trial/protocol/bintoken/detail/decoder.hpp>
+#include <trial/protocol/bintoken/detail/endian.hpp>
 #include <trial/protocol/core/detail/lightweight_test.hpp>
 
 namespace format = trial::protocol::bintoken;
@@ -4437,6 +4438,77 @@ void run()
 
 } // namespace compact_float64_suite
 
+//-----------------------------------------------------------------------------
+// Byte order conversion
+//-----------------------------------------------------------------------------
+
+namespace endian_suite
+{
+
+void test_byteswap()
+{
+    TRIAL_PROTOCOL_TEST_EQUAL(format::detail::endian::byteswap(std::uint16_t(0x0102)), 0x0201);
+    TRIAL_PROTOCOL_TEST_EQUAL(format::detail::endian::byteswap(UINT32_C(0x01020304)), UINT32_C(0x04030201));
+    TRIAL_PROTOCOL_TEST_EQUAL(format::detail::endian::byteswap(UINT64_C(0x0102030405060708)), UINT64_C(0x0807060504030201));
+}
+
+void test_byteswap_copy_16()
+{
+    const value_type input[] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06 };
+    value_type output[sizeof(input)] = {};
+    format::detail::endian::byteswap_copy<2>(input, output, 3);
+    const value_type expected[] = { 0x02, 0x01, 0x04, 0x03, 0x06, 0x05 };
+    TRIAL_PROTOCOL_TEST_ALL_WITH(output, output + sizeof(output),
+                                 expected, expected + sizeof(expected),
+                                 std::equal_to<value_type>());
+}
+
+void test_byteswap_copy_32()
+{
+    const value_type input[] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 };
+    value_type output[sizeof(input)] = {};
+    format::detail::endian::byteswap_copy<4>(input, output, 2);
+    const value_type expected[] = { 0x04, 0x03, 0x02, 0x01, 0x08, 0x07, 0x06, 0x05 };
+    TRIAL_PROTOCOL_TEST_ALL_WITH(output, output + sizeof(output),
+                                 expected, expected + sizeof(expected),
+                                 std::equal_to<value_type>());
+}
+
+void test_byteswap_copy_64()
+{
+    const value_type input[] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+                                 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18 };
+    value_type output[sizeof(input)] = {};
+    format::detail::endian::byteswap_copy<8>(input, output, 2);
+    const value_type expected[] = { 0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01,
+                                    0x18, 0x17, 0x16, 0x15, 0x14, 0x13, 0x12, 0x11 };
+    TRIAL_PROTOCOL_TEST_ALL_WITH(output, output + sizeof(output),
+                                 expected, expected + sizeof(expected),
+                                 std::equal_to<value_type>());
+}
+
+void test_decode_array_unaligned()
+{
+    const value_type input[] = { 0x00,
+                                 0x00, 0x00, 0x80, 0x3F,
+                                 0x00, 0x00, 0x00, 0x40 };
+    token::float32::type output[2] = {};
+    format::detail::endian::decode_array(input + 1, output, 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(output[0], 1.0f);
+    TRIAL_PROTOCOL_TEST_EQUAL(output[1], 2.0f);
+}
+
+void run()
+{
+    test_byteswap();
+    test_byteswap_copy_16();
+    test_byteswap_copy_32();
+    test_byteswap_copy_64();
+    test_decode_array_unaligned();
+}
+
+} // namespace endian_suite
+
 //-----------------------------------------------------------------------------
 // main
 //-----------------------------------------------------------------------------
@@ -4462,6 +4534,7 @@ int main()
     compact_int64_suite::run();
     compact_float32_suite::run();
     compact_float64_suite::run();
+    endian_suite::run();
 
     return boost::report_errors();
 }
@@ -962,6 +962,19 @@ void test_array()
                                  std::equal_to<variable>());
 }
 
+void test_array_oversized_count()
+{
+    // Untrusted count must not reserve memory for 2^40 elements
+    const value_type input[] = { bintoken::token::code::begin_array,
+                                 bintoken::token::code::int64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+                                 bintoken::token::code::end_array };
+    format::iarchive in(input);
+    variable value;
+    TRIAL_PROTOCOL_TEST_NO_THROW(in >> value);
+    TRIAL_PROTOCOL_TEST_EQUAL(value.is<array>(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(value.size(), 0);
+}
+
 void test_map_empty()
 {
     const value_type input[] = { bintoken::token::code::begin_assoc_array,
@@ -996,6 +1009,25 @@ void test_map()
                                  std::equal_to<variable>());
 }
 
+void test_map_count()
+{
+    const value_type input[] = { bintoken::token::code::begin_assoc_array,
+                                 0x01,
+                                 bintoken::token::code::begin_record,
+                                 bintoken::token::code::string8, 0x03, 0x41, 0x42, 0x43,
+                                 bintoken::token::code::true_value,
+                                 bintoken::token::code::end_record,
+                                 bintoken::token::code::end_assoc_array };
+    format::iarchive in(input);
+    variable value;
+    TRIAL_PROTOCOL_TEST_NO_THROW(in >> value);
+    TRIAL_PROTOCOL_TEST_EQUAL(value.is<map>(), true);
+    variable expect = map::make({{ "ABC", true }});
+    TRIAL_PROTOCOL_TEST_ALL_WITH(value.begin(), value.end(),
+                                 expect.begin(), expect.end(),
+                                 std::equal_to<variable>());
+}
+
 void run()
 {
     test_null();
@@ -1006,8 +1038,10 @@ void run()
     test_string();
     test_array_empty();
     test_array();
+    test_array_oversized_count();
     test_map_empty();
     test_map();
+    test_map_count();
 }
 
 } // namespace dynamic_suite
@@ -726,7 +726,7 @@ void test_string_bool_empty()
     ar << value;
 
     output_type expected[] = { token::code::begin_assoc_array,
-                              token::code::null,
+                              0x00,
                               token::code::end_assoc_array };
     TRIAL_PROTOCOL_TEST_ALL_WITH(result.begin(), result.end(),
                                  expected, expected + sizeof(expected),
@@ -742,7 +742,7 @@ void test_string_bool_one()
     ar << value;
 
     output_type expected[] = { token::code::begin_assoc_array,
-                              token::code::null,
+                              0x01,
                               token::code::begin_record,
                               token::code::string8, 0x01, 0x41,
                               token::code::true_value,
@@ -763,7 +763,7 @@ void test_string_bool_two()
     ar << value;
 
     output_type expected[] = { token::code::begin_assoc_array,
-                              token::code::null,
+                              0x02,
                               token::code::begin_record,
                               token::code::string8, 0x01, 0x41,
                               token::code::true_value,
@@ -788,7 +788,7 @@ void test_int_string_two()
     ar << value;
 
     output_type expected[] = { token::code::begin_assoc_array,
-                              token::code::null,
+                              0x02,
                               token::code::begin_record,
                               0x11,
                               token::code::string8, 0x01, 0x41,
@@ -885,7 +885,7 @@ void test_map_empty()
     ar << value;
 
     output_type expected[] = { bintoken::token::code::begin_assoc_array,
-                               bintoken::token::code::null,
+                               0x00,
                                bintoken::token::code::end_assoc_array };
     TRIAL_PROTOCOL_TEST_ALL_WITH(result.begin(), result.end(),
                                  expected, expected + sizeof(expected),
@@ -900,7 +900,7 @@ void test_map()
     ar << value;
 
     output_type expected[] = { bintoken::token::code::begin_assoc_array,
-                               bintoken::token::code::null,
+                               0x01,
                                bintoken::token::code::begin_record,
                                bintoken::token::code::string8, 0x03, 0x41, 0x42, 0x43,
                                bintoken::token::code::true_value,
@@ -911,6 +911,34 @@ void test_map()
                                  std::equal_to<output_type>());
 }
 
+void test_map_nested()
+{
+    std::vector<output_type> result;
+    format::oarchive ar(result);
+    variable value = map::make({{ "A", map::make({{ "B", array::make({ true }) }}) }});
+    ar << value;
+
+    output_type expected[] = { bintoken::token::code::begin_assoc_array,
+                               0x01,
+                               bintoken::token::code::begin_record,
+                               bintoken::token::code::string8, 0x01, 0x41,
+                               bintoken::token::code::begin_assoc_array,
+                               0x01,
+                               bintoken::token::code::begin_record,
+                               bintoken::token::code::string8, 0x01, 0x42,
+                               bintoken::token::code::begin_array,
+                               0x01,
+                               bintoken::token::code::true_value,
+                               bintoken::token::code::end_array,
+                               bintoken::token::code::end_record,
+                               bintoken::token::code::end_assoc_array,
+                               bintoken::token::code::end_record,
+                               bintoken::token::code::end_assoc_array };
+    TRIAL_PROTOCOL_TEST_ALL_WITH(result.begin(), result.end(),
+                                 expected, expected + sizeof(expected),
+                                 std::equal_to<output_type>());
+}
+
 void run()
 {
     test_null();
@@ -922,6 +950,7 @@ void run()
     test_array();
     test_map_empty();
     test_map();
+    test_map_nested();
 }
 
 } // namespace dynamic_suite
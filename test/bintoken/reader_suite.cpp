@@ -10,8 +10,11 @@
 
 #include <functional>
 #include <limits>
+#include <vector>
 #include <trial/protocol/buffer/array.hpp>
+#include <trial/protocol/buffer/vector.hpp>
 #include <trial/protocol/bintoken/reader.hpp>
+#include <trial/protocol/bintoken/writer.hpp>
 #include <trial/protocol/core/detail/lightweight_test.hpp>
 
 namespace format = trial::protocol::bintoken;
@@ -1179,6 +1182,40 @@ void fail_float64_overflow()
                                     format::error, "overflow");
 }
 
+template <typename T>
+void roundtrip(std::size_t length)
+{
+    std::vector<T> data(length);
+    for (std::size_t i = 0; i < length; ++i)
+    {
+        data[i] = static_cast<T>(i * 3 + 1) * ((i % 2) ? T(-1) : T(1));
+    }
+    std::vector<value_type> output;
+    format::writer writer(output);
+    writer.array(data.data(), data.size());
+
+    format::reader reader(output);
+    TRIAL_PROTOCOL_TEST(reader.length() == length);
+    std::vector<T> result(length);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.array<T>(result.data(), result.size()), length);
+    TRIAL_PROTOCOL_TEST_ALL_WITH(result.begin(), result.end(),
+                                 data.begin(), data.end(),
+                                 std::equal_to<T>());
+}
+
+void test_roundtrip()
+{
+    // Lengths that select array8, array16, and array32 tokens
+    for (std::size_t length : { 0, 1, 7, 31, 1000, 20000 })
+    {
+        roundtrip<token::int16::type>(length);
+        roundtrip<token::int32::type>(length);
+        roundtrip<token::int64::type>(length);
+        roundtrip<token::float32::type>(length);
+        roundtrip<token::float64::type>(length);
+    }
+}
+
 void run()
 {
     test_int8();
@@ -1193,6 +1230,7 @@ void run()
     fail_float32_overflow();
     test_float64();
     fail_float64_overflow();
+    test_roundtrip();
 }
 
 } // namespace compact_suite
@@ -8,7 +8,10 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <array>
+#include <functional>
 #include <limits>
+#include <vector>
 #include <trial/protocol/buffer/array.hpp>
 #include <trial/protocol/buffer/string.hpp>
 #include <trial/protocol/buffer/vector.hpp>
@@ -637,6 +640,53 @@ void run()
 
 } // namespace assoc_array_suite
 
+//-----------------------------------------------------------------------------
+// Statically dispatched buffers
+//-----------------------------------------------------------------------------
+
+namespace static_suite
+{
+
+template <typename OutputType>
+using static_writer = format::basic_writer<2 * sizeof(void *), OutputType>;
+
+void test_vector()
+{
+    std::vector<output_type> result;
+    static_writer<std::vector<output_type>> writer(result);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value<token::begin_array>(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value(token::int16::type(0x0102)), 3);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value<token::end_array>(), 1);
+    const output_type expected[] = { token::code::begin_array,
+                                     token::code::int16, 0x02, 0x01,
+                                     token::code::end_array };
+    TRIAL_PROTOCOL_TEST_ALL_WITH(result.begin(), result.end(),
+                                 expected, expected + sizeof(expected),
+                                 std::equal_to<output_type>());
+}
+
+void test_array()
+{
+    std::array<output_type, 4> result;
+    static_writer<std::array<output_type, 4>> writer(result);
+    const token::int8::type data[] = { 0x11, 0x22 };
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.array(data, 2), 4);
+    const output_type expected[] = { token::code::array8_int8, 0x02, 0x11, 0x22 };
+    TRIAL_PROTOCOL_TEST_ALL_WITH(result.begin(), result.end(),
+                                 expected, expected + sizeof(expected),
+                                 std::equal_to<output_type>());
+    // Does not fit
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value(true), 0);
+}
+
+void run()
+{
+    test_vector();
+    test_array();
+}
+
+} // namespace static_suite
+
 //-----------------------------------------------------------------------------
 // main
 //-----------------------------------------------------------------------------
@@ -650,6 +700,7 @@ int main()
     record_suite::run();
     array_suite::run();
     assoc_array_suite::run();
+    static_suite::run();
 
     return boost::report_errors();
 }
@@ -0,0 +1,284 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include <trial/protocol/core/arena.hpp>
+#include <trial/protocol/json/parse.hpp>
+#include <trial/protocol/core/detail/lightweight_test.hpp>
+
+using namespace trial::protocol;
+
+//-----------------------------------------------------------------------------
+// Arena
+//-----------------------------------------------------------------------------
+
+namespace arena_suite
+{
+
+void test_empty()
+{
+    core::arena memory;
+    TRIAL_PROTOCOL_TEST_EQUAL(memory.capacity(), 0);
+}
+
+void test_alignment()
+{
+    core::arena memory;
+    memory.allocate(1, 1);
+    void *pointer = memory.allocate(8, 8);
+    TRIAL_PROTOCOL_TEST_EQUAL(reinterpret_cast<std::uintptr_t>(pointer) % 8, 0);
+    memory.allocate(3, 1);
+    pointer = memory.allocate(4, 4);
+    TRIAL_PROTOCOL_TEST_EQUAL(reinterpret_cast<std::uintptr_t>(pointer) % 4, 0);
+}
+
+void test_contiguous()
+{
+    core::arena memory;
+    char *first = static_cast<char *>(memory.allocate(16, 1));
+    char *second = static_cast<char *>(memory.allocate(16, 1));
+    TRIAL_PROTOCOL_TEST(second == first + 16);
+}
+
+void test_blocks()
+{
+    core::arena memory(1024);
+    memory.allocate(200, 1);
+    const auto capacity = memory.capacity();
+    TRIAL_PROTOCOL_TEST(capacity >= 1024);
+    // Fits into current block
+    memory.allocate(200, 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(memory.capacity(), capacity);
+    // Does not fit into current block
+    for (int i = 0; i < 4; ++i)
+    {
+        memory.allocate(200, 1);
+    }
+    TRIAL_PROTOCOL_TEST(memory.capacity() > capacity);
+}
+
+void test_large()
+{
+    core::arena memory(1024);
+    char *first = static_cast<char *>(memory.allocate(16, 1));
+    memory.allocate(4096, 8);
+    TRIAL_PROTOCOL_TEST(memory.capacity() >= 1024 + 4096);
+    // Current block is retained after large allocation
+    char *second = static_cast<char *>(memory.allocate(16, 1));
+    TRIAL_PROTOCOL_TEST(second == first + 16);
+}
+
+void test_release()
+{
+    core::arena memory;
+    memory.allocate(100, 1);
+    TRIAL_PROTOCOL_TEST(memory.capacity() > 0);
+    memory.release();
+    TRIAL_PROTOCOL_TEST_EQUAL(memory.capacity(), 0);
+    memory.allocate(100, 1);
+    TRIAL_PROTOCOL_TEST(memory.capacity() > 0);
+}
+
+void test_reset()
+{
+    core::arena memory(1024);
+    char *first = static_cast<char *>(memory.allocate(16, 1));
+    memory.allocate(4096, 8);
+    const auto capacity = memory.capacity();
+    memory.reset();
+    // Large block is released and current block is reused from the start
+    TRIAL_PROTOCOL_TEST(memory.capacity() < capacity);
+    TRIAL_PROTOCOL_TEST(memory.capacity() >= 1024);
+    char *second = static_cast<char *>(memory.allocate(16, 1));
+    TRIAL_PROTOCOL_TEST(second == first);
+}
+
+void test_reset_empty()
+{
+    core::arena memory;
+    memory.reset();
+    TRIAL_PROTOCOL_TEST_EQUAL(memory.capacity(), 0);
+    memory.allocate(100, 1);
+    TRIAL_PROTOCOL_TEST(memory.capacity() > 0);
+}
+
+void test_scope()
+{
+    TRIAL_PROTOCOL_TEST(core::arena::current() == nullptr);
+    core::arena outer;
+    {
+        core::arena::scope outer_scope(outer);
+        TRIAL_PROTOCOL_TEST(core::arena::current() == &outer);
+        core::arena inner;
+        {
+            core::arena::scope inner_scope(inner);
+            TRIAL_PROTOCOL_TEST(core::arena::current() == &inner);
+        }
+        TRIAL_PROTOCOL_TEST(core::arena::current() == &outer);
+    }
+    TRIAL_PROTOCOL_TEST(core::arena::current() == nullptr);
+}
+
+void run()
+{
+    test_empty();
+    test_alignment();
+    test_contiguous();
+    test_blocks();
+    test_large();
+    test_release();
+    test_reset();
+    test_reset_empty();
+    test_scope();
+}
+
+} // namespace arena_suite
+
+//-----------------------------------------------------------------------------
+// Allocator
+//-----------------------------------------------------------------------------
+
+namespace allocator_suite
+{
+
+void test_heap()
+{
+    core::arena_allocator<int> allocator;
+    TRIAL_PROTOCOL_TEST(allocator.resource() == nullptr);
+    std::vector<int, core::arena_allocator<int>> data(allocator);
+    data.assign(100, 42);
+    TRIAL_PROTOCOL_TEST_EQUAL(data.size(), 100);
+    TRIAL_PROTOCOL_TEST_EQUAL(data.back(), 42);
+}
+
+void test_explicit()
+{
+    core::arena memory;
+    core::arena_allocator<int> allocator(memory);
+    TRIAL_PROTOCOL_TEST(allocator.resource() == &memory);
+    std::vector<int, core::arena_allocator<int>> data(allocator);
+    data.assign(100, 42);
+    TRIAL_PROTOCOL_TEST(memory.capacity() > 0);
+    TRIAL_PROTOCOL_TEST_EQUAL(data.back(), 42);
+}
+
+void test_scope()
+{
+    core::arena memory;
+    core::arena::scope scope(memory);
+    using string_type = std::basic_string<char, std::char_traits<char>, core::arena_allocator<char>>;
+    string_type data(200, 'a');
+    TRIAL_PROTOCOL_TEST(data.get_allocator().resource() == &memory);
+    TRIAL_PROTOCOL_TEST(memory.capacity() > 0);
+}
+
+void test_rebind()
+{
+    core::arena memory;
+    core::arena_allocator<int> allocator(memory);
+    core::arena_allocator<double> other(allocator);
+    TRIAL_PROTOCOL_TEST(other.resource() == &memory);
+    TRIAL_PROTOCOL_TEST(allocator == other);
+    TRIAL_PROTOCOL_TEST(allocator != core::arena_allocator<int>());
+}
+
+void run()
+{
+    test_heap();
+    test_explicit();
+    test_scope();
+    test_rebind();
+}
+
+} // namespace allocator_suite
+
+//-----------------------------------------------------------------------------
+// Variable
+//-----------------------------------------------------------------------------
+
+namespace variable_suite
+{
+
+using variable_type = trial::dynamic::basic_variable<core::arena_allocator>;
+
+const char input[] = "{ \"alpha\": [ \"a long string that is not stored inline\", 2 ], \"bravo\": { \"charlie\": true } }";
+
+void test_copy_construct()
+{
+    std::unique_ptr<variable_type> kept;
+    {
+        core::arena memory;
+        auto result = json::parse(input, memory);
+        kept.reset(new variable_type(result));
+    }
+    TRIAL_PROTOCOL_TEST_EQUAL((*kept)["alpha"][0].value<variable_type::string_type>(), "a long string that is not stored inline");
+    TRIAL_PROTOCOL_TEST_EQUAL((*kept)["alpha"][1].value<int>(), 2);
+    TRIAL_PROTOCOL_TEST_EQUAL((*kept)["bravo"]["charlie"].value<bool>(), true);
+}
+
+void test_copy_assign()
+{
+    variable_type kept = variable_type::array_type{};
+    {
+        core::arena memory;
+        auto result = json::parse(input, memory);
+        kept = result;
+    }
+    TRIAL_PROTOCOL_TEST_EQUAL(kept["alpha"][0].value<variable_type::string_type>(), "a long string that is not stored inline");
+    TRIAL_PROTOCOL_TEST_EQUAL(kept["bravo"]["charlie"].value<bool>(), true);
+}
+
+void test_move_assign()
+{
+    variable_type kept;
+    {
+        core::arena memory;
+        kept = json::parse(input, memory);
+    }
+    TRIAL_PROTOCOL_TEST_EQUAL(kept["alpha"][0].value<variable_type::string_type>(), "a long string that is not stored inline");
+    TRIAL_PROTOCOL_TEST_EQUAL(kept["bravo"]["charlie"].value<bool>(), true);
+}
+
+void test_move_assign_same_arena()
+{
+    core::arena memory;
+    core::arena::scope scope(memory);
+    variable_type kept;
+    kept = json::parse(input, memory);
+    variable_type other;
+    other = std::move(kept);
+    TRIAL_PROTOCOL_TEST_EQUAL(other["alpha"][1].value<int>(), 2);
+}
+
+void run()
+{
+    test_copy_construct();
+    test_copy_assign();
+    test_move_assign();
+    test_move_assign_same_arena();
+}
+
+} // namespace variable_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    arena_suite::run();
+    allocator_suite::run();
+    variable_suite::run();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,154 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <trial/protocol/core/detail/lightweight_test.hpp>
+#include <trial/protocol/core/detail/small_stack.hpp>
+
+using namespace trial::protocol::core::detail;
+
+//-----------------------------------------------------------------------------
+// Basic
+//-----------------------------------------------------------------------------
+
+namespace basic_suite
+{
+
+void test_empty()
+{
+    small_stack<int, 2> stack;
+    TRIAL_PROTOCOL_TEST(stack.empty());
+    TRIAL_PROTOCOL_TEST_EQUAL(stack.size(), 0);
+    TRIAL_PROTOCOL_TEST_EQUAL(stack.inline_capacity(), 2);
+}
+
+void test_inline()
+{
+    small_stack<int, 2> stack;
+    stack.push(1);
+    TRIAL_PROTOCOL_TEST_EQUAL(stack.top(), 1);
+    stack.push(2);
+    TRIAL_PROTOCOL_TEST_EQUAL(stack.top(), 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(stack.size(), 2);
+    stack.pop();
+    TRIAL_PROTOCOL_TEST_EQUAL(stack.top(), 1);
+    stack.pop();
+    TRIAL_PROTOCOL_TEST(stack.empty());
+}
+
+void test_overflow()
+{
+    small_stack<int, 2> stack;
+    for (int i = 0; i < 10; ++i)
+    {
+        stack.push(i);
+        TRIAL_PROTOCOL_TEST_EQUAL(stack.top(), i);
+    }
+    TRIAL_PROTOCOL_TEST_EQUAL(stack.size(), 10);
+    for (int i = 9; i >= 0; --i)
+    {
+        TRIAL_PROTOCOL_TEST_EQUAL(stack.top(), i);
+        stack.pop();
+    }
+    TRIAL_PROTOCOL_TEST(stack.empty());
+}
+
+void test_modify_top()
+{
+    small_stack<int, 1> stack;
+    stack.push(1);
+    stack.top() = 10;
+    stack.push(2);
+    stack.top() = 20;
+    TRIAL_PROTOCOL_TEST_EQUAL(stack.top(), 20);
+    stack.pop();
+    TRIAL_PROTOCOL_TEST_EQUAL(stack.top(), 10);
+}
+
+void run()
+{
+    test_empty();
+    test_inline();
+    test_overflow();
+    test_modify_top();
+}
+
+} // namespace basic_suite
+
+//-----------------------------------------------------------------------------
+// Copy
+//-----------------------------------------------------------------------------
+
+namespace copy_suite
+{
+
+void copy_inline()
+{
+    small_stack<int, 4> stack;
+    stack.push(1);
+    stack.push(2);
+    small_stack<int, 4> other(stack);
+    TRIAL_PROTOCOL_TEST_EQUAL(other.size(), 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(other.top(), 2);
+    other.pop();
+    TRIAL_PROTOCOL_TEST_EQUAL(other.top(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(stack.top(), 2);
+}
+
+void copy_overflow()
+{
+    small_stack<int, 2> stack;
+    stack.push(1);
+    stack.push(2);
+    stack.push(3);
+    small_stack<int, 2> other(stack);
+    TRIAL_PROTOCOL_TEST_EQUAL(other.size(), 3);
+    TRIAL_PROTOCOL_TEST_EQUAL(other.top(), 3);
+    other.pop();
+    TRIAL_PROTOCOL_TEST_EQUAL(other.top(), 2);
+    other.pop();
+    TRIAL_PROTOCOL_TEST_EQUAL(other.top(), 1);
+}
+
+void assign_overflow()
+{
+    small_stack<int, 2> stack;
+    stack.push(1);
+    stack.push(2);
+    stack.push(3);
+    small_stack<int, 2> other;
+    other.push(42);
+    other = stack;
+    TRIAL_PROTOCOL_TEST_EQUAL(other.size(), 3);
+    TRIAL_PROTOCOL_TEST_EQUAL(other.top(), 3);
+    other.pop();
+    other.pop();
+    TRIAL_PROTOCOL_TEST_EQUAL(other.top(), 1);
+}
+
+void run()
+{
+    copy_inline();
+    copy_overflow();
+    assign_overflow();
+}
+
+} // namespace copy_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    basic_suite::run();
+    copy_suite::run();
+
+    return boost::report_errors();
+}
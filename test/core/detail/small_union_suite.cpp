@@ -76,6 +76,40 @@ void move_assign_int()
     TRIAL_PROTOCOL_TEST_EQUAL(other.get<bool>(), true);
 }
 
+void copy_construct_string()
+{
+    // Inline
+    {
+        test_union<std::string, bool, std::string> data{std::string("alpha")};
+        test_union<std::string, bool, std::string> other(data);
+        TRIAL_PROTOCOL_TEST_EQUAL(other.get<std::string>(), "alpha");
+        TRIAL_PROTOCOL_TEST_EQUAL(data.get<std::string>(), "alpha");
+    }
+    // Heap
+    {
+        test_union<void *, bool, std::string> data{std::string("alpha")};
+        test_union<void *, bool, std::string> other(data);
+        TRIAL_PROTOCOL_TEST_EQUAL(other.get<std::string>(), "alpha");
+        TRIAL_PROTOCOL_TEST_EQUAL(data.get<std::string>(), "alpha");
+    }
+}
+
+void move_construct_string()
+{
+    // Inline
+    {
+        test_union<std::string, bool, std::string> data{std::string("alpha")};
+        test_union<std::string, bool, std::string> other(std::move(data));
+        TRIAL_PROTOCOL_TEST_EQUAL(other.get<std::string>(), "alpha");
+    }
+    // Heap
+    {
+        test_union<void *, bool, std::string> data{std::string("alpha")};
+        test_union<void *, bool, std::string> other(std::move(data));
+        TRIAL_PROTOCOL_TEST_EQUAL(other.get<std::string>(), "alpha");
+    }
+}
+
 void run()
 {
     construct_int();
@@ -85,6 +119,8 @@ void run()
     move_construct_int();
     copy_assign_int();
     move_assign_int();
+    copy_construct_string();
+    move_construct_string();
 }
 
 } // namespace ctor_suite
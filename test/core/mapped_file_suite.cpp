@@ -0,0 +1,139 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <trial/protocol/core/mapped_file.hpp>
+#include <trial/protocol/json/reader.hpp>
+#include <trial/protocol/bintoken/reader.hpp>
+#include <trial/protocol/core/detail/lightweight_test.hpp>
+
+using namespace trial::protocol;
+
+namespace
+{
+
+const char filename[] = "core_mapped_file_suite.tmp";
+
+void create(const std::string& content)
+{
+    std::ofstream output(filename, std::ios::binary | std::ios::trunc);
+    output.write(content.data(), std::streamsize(content.size()));
+}
+
+} // anonymous namespace
+
+//-----------------------------------------------------------------------------
+// Mapping
+//-----------------------------------------------------------------------------
+
+namespace mapping_suite
+{
+
+void test_content()
+{
+    create("alpha");
+    core::mapped_file file(filename);
+    TRIAL_PROTOCOL_TEST_EQUAL(file.size(), 5);
+    TRIAL_PROTOCOL_TEST(file.data() != nullptr);
+    TRIAL_PROTOCOL_TEST_EQUAL(file.view(), "alpha");
+}
+
+void test_empty()
+{
+    create("");
+    core::mapped_file file(std::string{filename});
+    TRIAL_PROTOCOL_TEST_EQUAL(file.size(), 0);
+    TRIAL_PROTOCOL_TEST(file.data() == nullptr);
+    TRIAL_PROTOCOL_TEST(file.view().empty());
+}
+
+void test_move()
+{
+    create("alpha");
+    core::mapped_file file(filename);
+    const void *data = file.data();
+    core::mapped_file other(std::move(file));
+    TRIAL_PROTOCOL_TEST(other.data() == data);
+    TRIAL_PROTOCOL_TEST_EQUAL(other.size(), 5);
+    TRIAL_PROTOCOL_TEST(file.data() == nullptr);
+    TRIAL_PROTOCOL_TEST_EQUAL(file.size(), 0);
+}
+
+void fail_missing()
+{
+    std::remove(filename);
+    TRIAL_PROTOCOL_TEST_THROWS(core::mapped_file{filename}, std::system_error);
+}
+
+void run()
+{
+    test_content();
+    test_empty();
+    test_move();
+    fail_missing();
+}
+
+} // namespace mapping_suite
+
+//-----------------------------------------------------------------------------
+// Readers
+//-----------------------------------------------------------------------------
+
+namespace reader_suite
+{
+
+void test_json()
+{
+    create("[42,\"alpha\"]");
+    core::mapped_file file(filename);
+    json::reader reader(file.view());
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), json::token::code::begin_array);
+    TRIAL_PROTOCOL_TEST(reader.next());
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.value<int>(), 42);
+    TRIAL_PROTOCOL_TEST(reader.next());
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.value<std::string>(), "alpha");
+    TRIAL_PROTOCOL_TEST(reader.next());
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), json::token::code::end_array);
+}
+
+void test_bintoken()
+{
+    const char input[] = { char(bintoken::token::code::int8), char(0x2A) };
+    create(std::string(input, sizeof(input)));
+    core::mapped_file file(filename);
+    bintoken::reader reader(file.view<std::uint8_t>());
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), bintoken::token::code::int8);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.value<std::int8_t>(), 42);
+}
+
+void run()
+{
+    test_json();
+    test_bintoken();
+}
+
+} // namespace reader_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    mapping_suite::run();
+    reader_suite::run();
+    std::remove(filename);
+
+    return boost::report_errors();
+}
@@ -0,0 +1,79 @@
+#ifndef TRIAL_PROTOCOL_TEST_COUNTING_ALLOCATOR_HPP
+#define TRIAL_PROTOCOL_TEST_COUNTING_ALLOCATOR_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+// Allocator for tests that verify the number of heap allocations.
+
+#include <cstddef> // std::size_t
+#include <memory>
+#include <type_traits>
+
+namespace trial
+{
+namespace protocol
+{
+namespace test
+{
+
+struct allocation_count
+{
+    // Allocations of any type
+    std::size_t total;
+    // Allocations of characters, which are string buffers
+    std::size_t characters;
+};
+
+inline allocation_count& allocations()
+{
+    static allocation_count instance = { 0, 0 };
+    return instance;
+}
+
+inline void reset_allocations()
+{
+    allocations() = { 0, 0 };
+}
+
+template <typename T>
+struct counting_allocator : public std::allocator<T>
+{
+    template <typename U>
+    struct rebind
+    {
+        using other = counting_allocator<U>;
+    };
+
+    counting_allocator() = default;
+
+    template <typename U>
+    counting_allocator(const counting_allocator<U>&) {}
+
+    T *allocate(std::size_t size)
+    {
+        ++allocations().total;
+        if (std::is_same<T, char>::value)
+            ++allocations().characters;
+        return std::allocator<T>::allocate(size);
+    }
+};
+
+template <typename T, typename U>
+bool operator== (const counting_allocator<T>&, const counting_allocator<U>&) { return true; }
+
+template <typename T, typename U>
+bool operator!= (const counting_allocator<T>&, const counting_allocator<U>&) { return false; }
+
+} // namespace test
+} // namespace protocol
+} // namespace trial
+
+#endif // TRIAL_PROTOCOL_TEST_COUNTING_ALLOCATOR_HPP
@@ -0,0 +1,264 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <trial/protocol/core/detail/lightweight_test.hpp>
+#include <trial/dynamic/flat_variable.hpp>
+#include <trial/dynamic/algorithm.hpp>
+
+using namespace trial::dynamic;
+
+//-----------------------------------------------------------------------------
+// Container
+//-----------------------------------------------------------------------------
+
+namespace container_suite
+{
+
+using map_type = detail::flat_map<int, std::string>;
+
+void test_empty()
+{
+    map_type data;
+    TRIAL_PROTOCOL_TEST(data.empty());
+    TRIAL_PROTOCOL_TEST_EQUAL(data.size(), 0);
+    TRIAL_PROTOCOL_TEST(data.find(1) == data.end());
+    TRIAL_PROTOCOL_TEST_EQUAL(data.count(1), 0);
+}
+
+void test_insert()
+{
+    map_type data;
+    auto result = data.insert({ 2, "bravo" });
+    TRIAL_PROTOCOL_TEST(result.second);
+    TRIAL_PROTOCOL_TEST_EQUAL(result.first->first, 2);
+    result = data.insert({ 1, "alpha" });
+    TRIAL_PROTOCOL_TEST(result.second);
+    result = data.insert({ 3, "charlie" });
+    TRIAL_PROTOCOL_TEST(result.second);
+    result = data.insert({ 2, "delta" });
+    TRIAL_PROTOCOL_TEST(!result.second);
+    TRIAL_PROTOCOL_TEST_EQUAL(result.first->second, "bravo");
+    TRIAL_PROTOCOL_TEST_EQUAL(data.size(), 3);
+    TRIAL_PROTOCOL_TEST_EQUAL(data.begin()->first, 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(std::prev(data.end())->first, 3);
+}
+
+void test_insert_hint()
+{
+    map_type data;
+    data.insert(data.end(), { 1, "alpha" });
+    data.insert(data.end(), { 3, "charlie" });
+    // Correct hint
+    auto where = data.insert(std::prev(data.end()), { 2, "bravo" });
+    TRIAL_PROTOCOL_TEST_EQUAL(where->first, 2);
+    // Wrong hint
+    where = data.insert(data.begin(), { 4, "delta" });
+    TRIAL_PROTOCOL_TEST_EQUAL(where->first, 4);
+    // Duplicate
+    where = data.insert(data.end(), { 1, "echo" });
+    TRIAL_PROTOCOL_TEST_EQUAL(where->second, "alpha");
+    TRIAL_PROTOCOL_TEST_EQUAL(data.size(), 4);
+    TRIAL_PROTOCOL_TEST(std::is_sorted(data.begin(), data.end(), data.value_comp()));
+}
+
+void test_insert_range()
+{
+    map_type data = { { 5, "echo" }, { 1, "alpha" } };
+    map_type::value_type input[] = { { 3, "charlie" }, { 5, "golf" }, { 2, "bravo" }, { 3, "hotel" } };
+    data.insert(std::begin(input), std::end(input));
+    TRIAL_PROTOCOL_TEST_EQUAL(data.size(), 4);
+    TRIAL_PROTOCOL_TEST(std::is_sorted(data.begin(), data.end(), data.value_comp()));
+    // Existing and first inserted values are retained
+    TRIAL_PROTOCOL_TEST_EQUAL(data.at(3), "charlie");
+    TRIAL_PROTOCOL_TEST_EQUAL(data.at(5), "echo");
+}
+
+void test_subscript()
+{
+    map_type data;
+    data[2] = "bravo";
+    data[1] = "alpha";
+    data[2] = "charlie";
+    TRIAL_PROTOCOL_TEST_EQUAL(data.size(), 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(data[1], "alpha");
+    TRIAL_PROTOCOL_TEST_EQUAL(data[2], "charlie");
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(data.at(3), std::out_of_range, "flat_map::at");
+}
+
+void test_erase()
+{
+    map_type data = { { 1, "alpha" }, { 2, "bravo" }, { 3, "charlie" } };
+    TRIAL_PROTOCOL_TEST_EQUAL(data.erase(2), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(data.erase(2), 0);
+    auto where = data.erase(data.begin());
+    TRIAL_PROTOCOL_TEST_EQUAL(where->first, 3);
+    TRIAL_PROTOCOL_TEST_EQUAL(data.size(), 1);
+}
+
+void test_bounds()
+{
+    map_type data = { { 1, "alpha" }, { 3, "charlie" } };
+    TRIAL_PROTOCOL_TEST_EQUAL(data.lower_bound(2)->first, 3);
+    TRIAL_PROTOCOL_TEST_EQUAL(data.lower_bound(3)->first, 3);
+    TRIAL_PROTOCOL_TEST(data.upper_bound(3) == data.end());
+    auto range = data.equal_range(1);
+    TRIAL_PROTOCOL_TEST_EQUAL(std::distance(range.first, range.second), 1);
+    range = data.equal_range(2);
+    TRIAL_PROTOCOL_TEST(range.first == range.second);
+}
+
+void test_compare()
+{
+    map_type alpha = { { 1, "alpha" } };
+    map_type bravo = { { 1, "bravo" } };
+    TRIAL_PROTOCOL_TEST(alpha == alpha);
+    TRIAL_PROTOCOL_TEST(alpha != bravo);
+    TRIAL_PROTOCOL_TEST(alpha < bravo);
+    TRIAL_PROTOCOL_TEST(bravo > alpha);
+}
+
+void run()
+{
+    test_empty();
+    test_insert();
+    test_insert_hint();
+    test_insert_range();
+    test_subscript();
+    test_erase();
+    test_bounds();
+    test_compare();
+}
+
+} // namespace container_suite
+
+//-----------------------------------------------------------------------------
+// Variable
+//-----------------------------------------------------------------------------
+
+namespace variable_suite
+{
+
+using string_type = flat_variable::string_type;
+
+void test_type()
+{
+    static_assert(std::is_same<flat_variable::map_type,
+                               detail::flat_map<flat_variable,
+                                                flat_variable,
+                                                std::less<flat_variable>,
+                                                flat_allocator<std::pair<flat_variable, flat_variable>>>>::value,
+                  "flat_variable must use flat_map");
+    static_assert(std::is_same<variable::map_type::key_compare, std::less<variable>>::value,
+                  "variable must use std::map");
+}
+
+void test_make()
+{
+    flat_variable data = flat_map::make({ { "charlie", 3 }, { "alpha", 1 }, { "bravo", 2 } });
+    TRIAL_PROTOCOL_TEST(data.is<map>());
+    TRIAL_PROTOCOL_TEST_EQUAL(data.size(), 3);
+    auto it = data.key_begin();
+    TRIAL_PROTOCOL_TEST_EQUAL((*it).value<string_type>(), "alpha");
+    ++it;
+    TRIAL_PROTOCOL_TEST_EQUAL((*it).value<string_type>(), "bravo");
+    ++it;
+    TRIAL_PROTOCOL_TEST_EQUAL((*it).value<string_type>(), "charlie");
+    ++it;
+    TRIAL_PROTOCOL_TEST(it == data.key_end());
+}
+
+void test_subscript()
+{
+    flat_variable data = flat_map::make();
+    data["bravo"] = 2;
+    data["alpha"] = 1;
+    data["bravo"] = "hydrogen";
+    TRIAL_PROTOCOL_TEST_EQUAL(data.size(), 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(data["alpha"].value<int>(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(data["bravo"].value<string_type>(), "hydrogen");
+    const flat_variable& view = data;
+    TRIAL_PROTOCOL_TEST_EQUAL(view["alpha"].value<int>(), 1);
+}
+
+void test_insert()
+{
+    flat_variable data = flat_map::make({ { "bravo", 2 } });
+    auto where = data.insert(flat_array::make({ "alpha", 1 }));
+    TRIAL_PROTOCOL_TEST_EQUAL(where.key().value<string_type>(), "alpha");
+    TRIAL_PROTOCOL_TEST_EQUAL(where.value().value<int>(), 1);
+    data += flat_map::make({ { "charlie", 3 } });
+    TRIAL_PROTOCOL_TEST_EQUAL(data.size(), 3);
+    TRIAL_PROTOCOL_TEST_EQUAL(data["charlie"].value<int>(), 3);
+}
+
+void test_erase()
+{
+    flat_variable data = flat_map::make({ { "alpha", 1 }, { "bravo", 2 }, { "charlie", 3 } });
+    auto where = data.erase(data.begin());
+    TRIAL_PROTOCOL_TEST_EQUAL(where.key().value<string_type>(), "bravo");
+    TRIAL_PROTOCOL_TEST_EQUAL(data.size(), 2);
+}
+
+void test_algorithm()
+{
+    flat_variable data = flat_map::make({ { "alpha", 1 }, { "bravo", 2 }, { "charlie", 2 } });
+    auto key = key::find(data, "bravo");
+    TRIAL_PROTOCOL_TEST_EQUAL(std::distance(data.key_begin(), key), 1);
+    auto value = value::find(data, 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(value.key().value<string_type>(), "bravo");
+    TRIAL_PROTOCOL_TEST_EQUAL(key::count(data, "charlie"), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(value::count(data, 2), 2);
+    auto next = key::erase(data, "alpha");
+    TRIAL_PROTOCOL_TEST_EQUAL((*next).value<string_type>(), "bravo");
+    TRIAL_PROTOCOL_TEST_EQUAL(data.size(), 2);
+    next = key::erase(data, "charlie");
+    TRIAL_PROTOCOL_TEST(next == data.key_end());
+    TRIAL_PROTOCOL_TEST_EQUAL(data.size(), 1);
+}
+
+void test_compare()
+{
+    flat_variable alpha = flat_map::make({ { "alpha", 1 } });
+    flat_variable bravo = flat_map::make({ { "alpha", 2 } });
+    flat_variable copy = alpha;
+    TRIAL_PROTOCOL_TEST(alpha == copy);
+    TRIAL_PROTOCOL_TEST(alpha != bravo);
+    TRIAL_PROTOCOL_TEST(alpha < bravo);
+}
+
+void run()
+{
+    test_type();
+    test_make();
+    test_subscript();
+    test_insert();
+    test_erase();
+    test_algorithm();
+    test_compare();
+}
+
+} // namespace variable_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    container_suite::run();
+    variable_suite::run();
+
+    return boost::report_errors();
+}
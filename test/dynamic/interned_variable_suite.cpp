@@ -0,0 +1,271 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <trial/protocol/core/detail/lightweight_test.hpp>
+#include <trial/dynamic/interned_variable.hpp>
+
+using namespace trial::dynamic;
+
+//-----------------------------------------------------------------------------
+// Shared string
+//-----------------------------------------------------------------------------
+
+namespace string_suite
+{
+
+using string_type = detail::basic_shared_string<char>;
+
+const char *long_text = "alpha bravo charlie delta";
+
+void test_empty()
+{
+    string_type data;
+    TRIAL_PROTOCOL_TEST(data.empty());
+    TRIAL_PROTOCOL_TEST_EQUAL(data.size(), 0);
+    TRIAL_PROTOCOL_TEST_EQUAL(data.c_str(), std::string());
+}
+
+void test_short()
+{
+    string_type data("alpha");
+    TRIAL_PROTOCOL_TEST_EQUAL(data.size(), 5);
+    TRIAL_PROTOCOL_TEST_EQUAL(data.c_str(), std::string("alpha"));
+    string_type copy = data;
+    TRIAL_PROTOCOL_TEST(copy == data);
+    TRIAL_PROTOCOL_TEST(!copy.shares(data));
+}
+
+void test_long()
+{
+    string_type data(long_text);
+    TRIAL_PROTOCOL_TEST_EQUAL(data.c_str(), std::string(long_text));
+    string_type copy = data;
+    TRIAL_PROTOCOL_TEST(copy == data);
+    TRIAL_PROTOCOL_TEST(copy.shares(data));
+    TRIAL_PROTOCOL_TEST_EQUAL(copy.data(), data.data());
+}
+
+void test_move()
+{
+    string_type data(long_text);
+    const auto address = data.data();
+    string_type moved(std::move(data));
+    TRIAL_PROTOCOL_TEST_EQUAL(moved.data(), address);
+    TRIAL_PROTOCOL_TEST(data.empty());
+    data = std::move(moved);
+    TRIAL_PROTOCOL_TEST_EQUAL(data.data(), address);
+}
+
+void test_append_short()
+{
+    string_type data("alpha");
+    data += "bravo";
+    TRIAL_PROTOCOL_TEST(data == "alphabravo");
+    data += " charlie delta";
+    TRIAL_PROTOCOL_TEST(data == "alphabravo charlie delta");
+}
+
+void test_append_shared()
+{
+    // Appending to a shared buffer leaves the other strings unchanged
+    string_type data(long_text);
+    string_type copy = data;
+    data += " echo";
+    TRIAL_PROTOCOL_TEST(data == "alpha bravo charlie delta echo");
+    TRIAL_PROTOCOL_TEST(copy == long_text);
+    TRIAL_PROTOCOL_TEST(!copy.shares(data));
+}
+
+void test_append_self()
+{
+    string_type data(long_text);
+    data += data;
+    TRIAL_PROTOCOL_TEST(data == "alpha bravo charlie deltaalpha bravo charlie delta");
+}
+
+void test_clear()
+{
+    string_type data(long_text);
+    string_type copy = data;
+    data.clear();
+    TRIAL_PROTOCOL_TEST(data.empty());
+    TRIAL_PROTOCOL_TEST(copy == long_text);
+}
+
+void test_compare()
+{
+    string_type alpha("alpha bravo charlie");
+    string_type bravo("alpha bravo delta");
+    TRIAL_PROTOCOL_TEST(alpha < bravo);
+    TRIAL_PROTOCOL_TEST(alpha != bravo);
+    TRIAL_PROTOCOL_TEST(alpha == string_type("alpha bravo charlie"));
+    TRIAL_PROTOCOL_TEST(string_type("alpha") < string_type("alpha bravo"));
+    TRIAL_PROTOCOL_TEST(string_type("alpha") == "alpha");
+    TRIAL_PROTOCOL_TEST(string_type("alpha") != "alph");
+}
+
+void test_stream()
+{
+    std::ostringstream stream;
+    stream << string_type(long_text);
+    TRIAL_PROTOCOL_TEST_EQUAL(stream.str(), long_text);
+}
+
+void run()
+{
+    test_empty();
+    test_short();
+    test_long();
+    test_move();
+    test_append_short();
+    test_append_shared();
+    test_append_self();
+    test_clear();
+    test_compare();
+    test_stream();
+}
+
+} // namespace string_suite
+
+//-----------------------------------------------------------------------------
+// String pool
+//-----------------------------------------------------------------------------
+
+namespace pool_suite
+{
+
+const std::string long_text = "alpha bravo charlie delta";
+
+void test_intern()
+{
+    string_pool pool;
+    auto alpha = pool.intern(long_text.data(), long_text.size());
+    const std::string other = long_text;
+    auto bravo = pool.intern(other.data(), other.size());
+    TRIAL_PROTOCOL_TEST(alpha.shares(bravo));
+    TRIAL_PROTOCOL_TEST_EQUAL(pool.size(), 1);
+}
+
+void test_intern_different()
+{
+    string_pool pool;
+    auto alpha = pool.intern(long_text.data(), long_text.size());
+    auto bravo = pool.intern(long_text.data(), long_text.size() - 1);
+    TRIAL_PROTOCOL_TEST(!alpha.shares(bravo));
+    TRIAL_PROTOCOL_TEST(alpha != bravo);
+    TRIAL_PROTOCOL_TEST_EQUAL(pool.size(), 2);
+}
+
+void test_intern_short()
+{
+    // Short strings are not pooled
+    string_pool pool;
+    auto alpha = pool.intern("alpha", 5);
+    TRIAL_PROTOCOL_TEST(alpha == "alpha");
+    TRIAL_PROTOCOL_TEST_EQUAL(pool.size(), 0);
+}
+
+void test_clear()
+{
+    string_pool pool;
+    auto alpha = pool.intern(long_text.data(), long_text.size());
+    pool.clear();
+    TRIAL_PROTOCOL_TEST_EQUAL(pool.size(), 0);
+    TRIAL_PROTOCOL_TEST_EQUAL(alpha.c_str(), long_text);
+    auto bravo = pool.intern(long_text.data(), long_text.size());
+    TRIAL_PROTOCOL_TEST(alpha == bravo);
+    TRIAL_PROTOCOL_TEST(!alpha.shares(bravo));
+}
+
+void run()
+{
+    test_intern();
+    test_intern_different();
+    test_intern_short();
+    test_clear();
+}
+
+} // namespace pool_suite
+
+//-----------------------------------------------------------------------------
+// Variable
+//-----------------------------------------------------------------------------
+
+namespace variable_suite
+{
+
+using string_type = interned_variable::string_type;
+
+void test_type()
+{
+    static_assert(std::is_same<string_type, detail::basic_shared_string<char>>::value, "shared string");
+    static_assert(std::is_same<variable::string_type, std::string>::value, "std::string");
+}
+
+void test_string()
+{
+    interned_variable data = "alpha bravo charlie delta";
+    TRIAL_PROTOCOL_TEST(data.is<string>());
+    TRIAL_PROTOCOL_TEST(data == "alpha bravo charlie delta");
+    TRIAL_PROTOCOL_TEST_EQUAL(data.value<string_type>().size(), 25);
+    data += " echo";
+    TRIAL_PROTOCOL_TEST(data == "alpha bravo charlie delta echo");
+}
+
+void test_copy()
+{
+    interned_variable data = "alpha bravo charlie delta";
+    interned_variable copy = data;
+    TRIAL_PROTOCOL_TEST(copy == data);
+    TRIAL_PROTOCOL_TEST(copy.assume_value<string_type>().shares(data.assume_value<string_type>()));
+}
+
+void test_map()
+{
+    string_pool pool;
+    const std::string key = "alpha bravo charlie delta";
+    interned_variable first = interned_map::make();
+    first[pool.intern(key.data(), key.size())] = 1;
+    interned_variable second = interned_map::make();
+    second[pool.intern(key.data(), key.size())] = 2;
+    TRIAL_PROTOCOL_TEST_EQUAL(first[key.c_str()].value<int>(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(second[key.c_str()].value<int>(), 2);
+
+    const auto& alpha = first.key_begin().key().assume_value<string_type>();
+    const auto& bravo = second.key_begin().key().assume_value<string_type>();
+    TRIAL_PROTOCOL_TEST(alpha.shares(bravo));
+}
+
+void run()
+{
+    test_type();
+    test_string();
+    test_copy();
+    test_map();
+}
+
+} // namespace variable_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    string_suite::run();
+    pool_suite::run();
+    variable_suite::run();
+
+    return boost::report_errors();
+}
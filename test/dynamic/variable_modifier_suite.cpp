@@ -976,6 +976,55 @@ void insert_map_range_iterator()
     }
 }
 
+void insert_array_move()
+{
+    // Nested containers are moved rather than copied
+    {
+        variable element = array::make({ 1, 2 });
+        const variable *inner = &element[0];
+        variable data = array::make();
+        data.insert(std::move(element));
+        TRIAL_PROTOCOL_TEST_EQUAL(data.size(), 1);
+        TRIAL_PROTOCOL_TEST(&data[0][0] == inner);
+    }
+    {
+        variable element = array::make({ 1, 2 });
+        const variable *inner = &element[0];
+        variable data = array::make({ true });
+        data.insert(data.begin(), std::move(element));
+        TRIAL_PROTOCOL_TEST_EQUAL(data.size(), 2);
+        TRIAL_PROTOCOL_TEST(&data[0][0] == inner);
+    }
+}
+
+void insert_map_move()
+{
+    {
+        variable pair = array::make({ "alpha", array::make({ 1, 2 }) });
+        const variable *inner = &pair[1][0];
+        variable data = map::make();
+        auto where = data.insert(std::move(pair));
+        TRIAL_PROTOCOL_TEST(where.key() == "alpha");
+        TRIAL_PROTOCOL_TEST(&data["alpha"][0] == inner);
+    }
+    {
+        variable pair = array::make({ "alpha", array::make({ 1, 2 }) });
+        const variable *inner = &pair[1][0];
+        variable data = map::make();
+        auto where = data.insert(data.end(), std::move(pair));
+        TRIAL_PROTOCOL_TEST(where.key() == "alpha");
+        TRIAL_PROTOCOL_TEST(&data["alpha"][0] == inner);
+    }
+    // Not a pair
+    {
+        variable data = map::make();
+        variable element = array::make({ "alpha" });
+        TRIAL_PROTOCOL_TEST_THROW_EQUAL(data.insert(std::move(element)),
+                                        error,
+                                        "incompatible type");
+    }
+}
+
 void run()
 {
     insert_null();
@@ -1002,6 +1051,9 @@ void run()
     insert_map_range();
     fail_map_range();
     insert_map_range_iterator();
+
+    insert_array_move();
+    insert_map_move();
 }
 
 } // namespace insert_suite
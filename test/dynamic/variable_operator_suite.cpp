@@ -2128,6 +2128,56 @@ void append_map_with_map()
     }
 }
 
+void append_move()
+{
+    // null
+    {
+        variable source = array::make({ 1, 2 });
+        const variable *inner = &source[0];
+        variable data;
+        data += std::move(source);
+        TRIAL_PROTOCOL_TEST(data.is<array>());
+        TRIAL_PROTOCOL_TEST(&data[0] == inner);
+    }
+    // array with array
+    {
+        variable source = array::make({ array::make({ 1, 2 }) });
+        const variable *inner = &source[0][0];
+        variable data = array::make({ true });
+        data += std::move(source);
+        TRIAL_PROTOCOL_TEST_EQUAL(data.size(), 2);
+        TRIAL_PROTOCOL_TEST(&data[1][0] == inner);
+    }
+    // array with null
+    {
+        variable data = array::make({ true });
+        data += variable();
+        TRIAL_PROTOCOL_TEST_EQUAL(data.size(), 1);
+    }
+    // map with map
+    {
+        variable source = map::make("bravo", array::make({ 1, 2 }));
+        const variable *inner = &source["bravo"][0];
+        variable data = map::make("alpha", true);
+        data += std::move(source);
+        TRIAL_PROTOCOL_TEST_EQUAL(data.size(), 2);
+        TRIAL_PROTOCOL_TEST(&data["bravo"][0] == inner);
+    }
+    // map with array
+    {
+        variable data = map::make("alpha", true);
+        TRIAL_PROTOCOL_TEST_THROW_EQUAL(data += array::make({ 1 }),
+                                        error,
+                                        "incompatible type");
+    }
+    // self
+    {
+        variable data = array::make({ 1, 2 });
+        data += std::move(data);
+        TRIAL_PROTOCOL_TEST_EQUAL(data.size(), 4);
+    }
+}
+
 void run()
 {
     append_null_with_null();
@@ -2209,6 +2259,8 @@ void run()
     append_map_with_string();
     append_map_with_array();
     append_map_with_map();
+
+    append_move();
 }
 
 } // namespace append_suite
@@ -10,8 +10,11 @@
 
 #include <limits>
 #include <functional>
+#include <memory>
+#include <string>
 #include <trial/protocol/core/detail/lightweight_test.hpp>
 #include <trial/dynamic/variable.hpp>
+#include "../counting_allocator.hpp"
 
 using namespace trial::dynamic;
 
@@ -6285,6 +6288,67 @@ void run()
 
 } // namespace value_suite
 
+//-----------------------------------------------------------------------------
+// Storage
+//-----------------------------------------------------------------------------
+
+namespace storage_suite
+{
+
+using trial::protocol::test::allocations;
+using trial::protocol::test::reset_allocations;
+using trial::protocol::test::counting_allocator;
+
+using counting_variable = basic_variable<counting_allocator>;
+using string_type = counting_variable::string_type;
+
+void test_short_string()
+{
+    reset_allocations();
+    counting_variable data("alpha");
+    TRIAL_PROTOCOL_TEST_EQUAL(allocations().total, 0);
+    TRIAL_PROTOCOL_TEST(data.is<string>());
+    TRIAL_PROTOCOL_TEST_EQUAL(data.assume_value<string_type>(), "alpha");
+    TRIAL_PROTOCOL_TEST_EQUAL(data.value<string_type>(), "alpha");
+    TRIAL_PROTOCOL_TEST(data == "alpha");
+    TRIAL_PROTOCOL_TEST(data < "bravo");
+
+    counting_variable copy(data);
+    TRIAL_PROTOCOL_TEST(copy == data);
+    counting_variable moved(std::move(copy));
+    TRIAL_PROTOCOL_TEST(moved == data);
+    TRIAL_PROTOCOL_TEST_EQUAL(allocations().total, 0);
+}
+
+void test_long_string()
+{
+    reset_allocations();
+    counting_variable data("alpha bravo charlie delta echo");
+    // Only the characters are allocated
+    TRIAL_PROTOCOL_TEST_EQUAL(allocations().total, 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(data.assume_value<string_type>(), "alpha bravo charlie delta echo");
+}
+
+void test_array()
+{
+    reset_allocations();
+    counting_variable data = basic_array<counting_allocator>::make();
+    TRIAL_PROTOCOL_TEST_EQUAL(allocations().total, 0);
+    data.insert("alpha");
+    // Only the element buffer is allocated
+    TRIAL_PROTOCOL_TEST_EQUAL(allocations().total, 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(data[0].value<string_type>(), "alpha");
+}
+
+void run()
+{
+    test_short_string();
+    test_long_string();
+    test_array();
+}
+
+} // namespace storage_suite
+
 //-----------------------------------------------------------------------------
 // main
 //-----------------------------------------------------------------------------
@@ -6302,5 +6366,7 @@ int main()
     assume_value_suite::run();
     value_suite::run();
 
+    storage_suite::run();
+
     return boost::report_errors();
 }
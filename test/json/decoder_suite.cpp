@@ -8,10 +8,12 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <cmath>
 #include <limits>
 #include <sstream>
 #include <iomanip>
 #include <trial/protocol/json/detail/decoder.hpp>
+#include <trial/protocol/core/detail/simd.hpp>
 #include <trial/protocol/core/detail/lightweight_test.hpp>
 
 using namespace trial::protocol;
@@ -634,6 +636,137 @@ void fail_unsigned_negative()
                                     json::error, "invalid value");
 }
 
+void test_digit_lengths()
+{
+    // Crosses the boundaries of eight digit conversion
+    std::uint64_t expected = 0;
+    std::string input;
+    for (int length = 1; length <= 19; ++length)
+    {
+        const int digit = length % 10;
+        expected = expected * 10 + std::uint64_t(digit == 0 ? 1 : digit);
+        input += char('0' + (digit == 0 ? 1 : digit));
+        {
+            decoder_type decoder(input);
+            TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::detail::code::integer);
+            TRIAL_PROTOCOL_TEST_EQUAL(decoder.value<std::uint64_t>(), expected);
+        }
+        {
+            const std::string negative = "-" + input;
+            decoder_type decoder(negative);
+            TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::detail::code::integer);
+            TRIAL_PROTOCOL_TEST_EQUAL(decoder.value<std::int64_t>(), -std::int64_t(expected));
+        }
+        {
+            // Followed by fraction
+            const std::string real = input + ".5";
+            decoder_type decoder(real);
+            TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::detail::code::real);
+            TRIAL_PROTOCOL_TEST_EQUAL(decoder.literal(), real);
+        }
+        {
+            // Followed by container end
+            const std::string item = input + "]";
+            decoder_type decoder(item);
+            TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::detail::code::integer);
+            TRIAL_PROTOCOL_TEST_EQUAL(decoder.literal(), input);
+        }
+    }
+}
+
+void test_uint64_limits()
+{
+    {
+        const char input[] = "18446744073709551615";
+        decoder_type decoder(input);
+        TRIAL_PROTOCOL_TEST_EQUAL(decoder.value<std::uint64_t>(), std::numeric_limits<std::uint64_t>::max());
+        TRIAL_PROTOCOL_TEST_THROW_EQUAL(decoder.value<std::int64_t>(),
+                                        json::error, "invalid value");
+    }
+    {
+        const char input[] = "18446744073709551616";
+        decoder_type decoder(input);
+        TRIAL_PROTOCOL_TEST_THROW_EQUAL(decoder.value<std::uint64_t>(),
+                                        json::error, "invalid value");
+    }
+    {
+        const char input[] = "-9223372036854775808";
+        decoder_type decoder(input);
+        TRIAL_PROTOCOL_TEST_EQUAL(decoder.value<std::int64_t>(), std::numeric_limits<std::int64_t>::lowest());
+    }
+    {
+        const char input[] = "-9223372036854775809";
+        decoder_type decoder(input);
+        TRIAL_PROTOCOL_TEST_THROW_EQUAL(decoder.value<std::int64_t>(),
+                                        json::error, "invalid value");
+    }
+    {
+        const char input[] = "-123456789012345678901234567890";
+        decoder_type decoder(input);
+        TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::detail::code::integer);
+        TRIAL_PROTOCOL_TEST_THROW_EQUAL(decoder.value<std::int64_t>(),
+                                        json::error, "invalid value");
+    }
+    {
+        const char input[] = "-128";
+        decoder_type decoder(input);
+        TRIAL_PROTOCOL_TEST_EQUAL(decoder.value<std::int8_t>(), -128);
+    }
+    {
+        const char input[] = "-129";
+        decoder_type decoder(input);
+        TRIAL_PROTOCOL_TEST_THROW_EQUAL(decoder.value<std::int8_t>(),
+                                        json::error, "invalid value");
+    }
+}
+
+void test_value_twice()
+{
+    const char input[] = "[123456789012,-42]";
+    decoder_type decoder(input);
+    decoder.next();
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.value<std::int64_t>(), 123456789012);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.value<std::uint64_t>(), 123456789012U);
+    decoder.next();
+    decoder.next();
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.value<int>(), -42);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.value<std::int16_t>(), -42);
+}
+
+#if defined(__SIZEOF_INT128__) && !defined(__STRICT_ANSI__)
+
+void regress_int128()
+{
+    // Negative integers must not be checked against a truncated limit
+    {
+        const char input[] = "-5";
+        decoder_type decoder(input);
+        __extension__ using value_type = __int128;
+        TRIAL_PROTOCOL_TEST(decoder.value<value_type>() == value_type(-5));
+    }
+    {
+        const char input[] = "-9223372036854775809";
+        decoder_type decoder(input);
+        __extension__ using value_type = __int128;
+        TRIAL_PROTOCOL_TEST(decoder.value<value_type>() == -value_type(9223372036854775807LL) - 2);
+    }
+    {
+        const char input[] = "-170141183460469231731687303715884105728";
+        decoder_type decoder(input);
+        __extension__ using value_type = __int128;
+        TRIAL_PROTOCOL_TEST(decoder.value<value_type>() == std::numeric_limits<value_type>::min());
+    }
+    {
+        const char input[] = "-170141183460469231731687303715884105729";
+        decoder_type decoder(input);
+        __extension__ using value_type = __int128;
+        TRIAL_PROTOCOL_TEST_THROW_EQUAL(decoder.value<value_type>(),
+                                        json::error, "invalid value");
+    }
+}
+
+#endif
+
 void fail_on_begin_array()
 {
     const char input[] = "[";
@@ -692,6 +825,12 @@ void run()
     test_intmax();
     test_unsigned();
     fail_unsigned_negative();
+    test_digit_lengths();
+    test_uint64_limits();
+    test_value_twice();
+#if defined(__SIZEOF_INT128__) && !defined(__STRICT_ANSI__)
+    regress_int128();
+#endif
 
     fail_on_begin_array();
     fail_on_end_array();
@@ -898,6 +1037,111 @@ void fail_as_string()
     TRIAL_PROTOCOL_TEST_THROW_EQUAL(decoder.value<std::string>(),
                                     json::error, "incompatible type");
 }
+void test_bounded_view()
+{
+    // Characters beyond the view must not be read
+    const char input[] = "1.5e3";
+    using real_decoder = json::detail::real_decoder<char, double>;
+    TRIAL_PROTOCOL_TEST_EQUAL(real_decoder::decode(decoder_type::view_type(input, 1)), 1.0);
+    TRIAL_PROTOCOL_TEST_EQUAL(real_decoder::decode(decoder_type::view_type(input, 3)), 1.5);
+    TRIAL_PROTOCOL_TEST_EQUAL(real_decoder::decode(decoder_type::view_type(input, 5)), 1.5e3);
+}
+
+void test_round_to_even()
+{
+    // Halfway between 2^53 and 2^53 + 2
+    const char input[] = "9007199254740993.0";
+    decoder_type decoder(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::detail::code::real);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.value<double>(), 9007199254740992.0);
+}
+
+void test_above_halfway()
+{
+    // Digits beyond the 19th decide the rounding
+    const char input[] = "9007199254740993.0000000000000000001";
+    decoder_type decoder(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::detail::code::real);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.value<double>(), 9007199254740994.0);
+}
+
+void test_many_digits()
+{
+    const char input[] = "3.14159265358979323846264338327950288419716939937510";
+    decoder_type decoder(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::detail::code::real);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.value<float>(), 3.14159265358979323846264338327950288419716939937510f);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.value<double>(), 3.14159265358979323846264338327950288419716939937510);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.value<long double>(), 3.14159265358979323846264338327950288419716939937510L);
+}
+
+void test_fraction()
+{
+    const char input[] = "0.1";
+    decoder_type decoder(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::detail::code::real);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.value<float>(), 0.1f);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.value<double>(), 0.1);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.value<long double>(), 0.1L);
+}
+
+void test_large_exponent()
+{
+    const char input[] = "1.2345678901234567e-150";
+    decoder_type decoder(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::detail::code::real);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.value<double>(), 1.2345678901234567e-150);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.value<long double>(), 1.2345678901234567e-150L);
+}
+
+void test_double_max()
+{
+    const char input[] = "1.7976931348623157e308";
+    decoder_type decoder(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::detail::code::real);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.value<double>(), std::numeric_limits<double>::max());
+}
+
+void test_double_min()
+{
+    const char input[] = "2.2250738585072014e-308";
+    decoder_type decoder(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::detail::code::real);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.value<double>(), std::numeric_limits<double>::min());
+}
+
+void test_double_denorm_min()
+{
+    const char input[] = "4.9406564584124654e-324";
+    decoder_type decoder(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::detail::code::real);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.value<double>(), std::numeric_limits<double>::denorm_min());
+}
+
+void test_double_underflow()
+{
+    const char input[] = "1e-400";
+    decoder_type decoder(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::detail::code::real);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.value<double>(), 0.0);
+}
+
+void test_double_overflow()
+{
+    const char input[] = "1e400";
+    decoder_type decoder(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::detail::code::real);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.value<double>(), std::numeric_limits<double>::infinity());
+}
+
+void test_minus_zero()
+{
+    const char input[] = "-0.0";
+    decoder_type decoder(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::detail::code::real);
+    TRIAL_PROTOCOL_TEST(std::signbit(decoder.value<double>()));
+}
+
 void run()
 {
     test_zero();
@@ -920,6 +1164,18 @@ void run()
     fail_zero_followed_by_digits();
     fail_as_int();
     fail_as_string();
+    test_bounded_view();
+    test_round_to_even();
+    test_above_halfway();
+    test_many_digits();
+    test_fraction();
+    test_large_exponent();
+    test_double_max();
+    test_double_min();
+    test_double_denorm_min();
+    test_double_underflow();
+    test_double_overflow();
+    test_minus_zero();
 }
 
 } // namespace real_suite
@@ -2025,6 +2281,131 @@ void run()
 
 } // namespace view_suite
 
+//-----------------------------------------------------------------------------
+// Vectorized scanning
+//-----------------------------------------------------------------------------
+
+namespace simd_suite
+{
+
+namespace simd = trial::protocol::core::detail::simd;
+
+// Run all tests for each instruction set supported by the processor
+template <typename Function>
+void for_each_instruction_set(Function function)
+{
+    const simd::instruction_set best = simd::detect();
+    const simd::instruction_set candidates[] = { simd::instruction_set::scalar,
+                                                 simd::instruction_set::sse2,
+                                                 simd::instruction_set::avx2 };
+    for (auto isa : candidates)
+    {
+        if (isa > best)
+            break;
+        simd::selected() = isa;
+        function();
+    }
+    simd::selected() = best;
+}
+
+void test_long_whitespaces()
+{
+    for_each_instruction_set([] {
+        for (std::size_t length = 0; length < 80; ++length)
+        {
+            std::string input(length, ' ');
+            for (std::size_t i = 0; i < length; ++i)
+                input[i] = "\n\t\r "[i % 4];
+            input += "null";
+            decoder_type decoder(input);
+            TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::detail::code::null);
+            TRIAL_PROTOCOL_TEST_EQUAL(decoder.literal(), "null");
+        }
+    });
+}
+
+void test_long_string()
+{
+    for_each_instruction_set([] {
+        for (std::size_t length = 0; length < 80; ++length)
+        {
+            std::string content(length, 'a');
+            std::string input = "\"" + content + "\"";
+            decoder_type decoder(input);
+            TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::detail::code::string);
+            TRIAL_PROTOCOL_TEST_EQUAL(decoder.value<std::string>(), content);
+            decoder.next();
+            TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::detail::code::end);
+        }
+    });
+}
+
+void test_long_string_escape()
+{
+    for_each_instruction_set([] {
+        for (std::size_t position = 0; position < 70; ++position)
+        {
+            std::string input = "\"" + std::string(70, 'a') + "\"";
+            input.insert(1 + position, "\\n");
+            decoder_type decoder(input);
+            TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::detail::code::string);
+            std::string expected(70, 'a');
+            expected.insert(position, "\n");
+            TRIAL_PROTOCOL_TEST_EQUAL(decoder.value<std::string>(), expected);
+        }
+    });
+}
+
+void test_long_string_utf8()
+{
+    for_each_instruction_set([] {
+        for (std::size_t position = 0; position < 70; ++position)
+        {
+            std::string input = "\"" + std::string(70, 'a') + "\"";
+            input.insert(1 + position, "\xC3\xA6");
+            decoder_type decoder(input);
+            TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::detail::code::string);
+        }
+    });
+}
+
+void fail_long_string_control()
+{
+    for_each_instruction_set([] {
+        for (std::size_t position = 0; position < 70; ++position)
+        {
+            std::string input = "\"" + std::string(70, 'a') + "\"";
+            input[1 + position] = '\x1F';
+            decoder_type decoder(input);
+            TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::detail::code::error_unexpected_token);
+        }
+    });
+}
+
+void fail_long_string_unterminated()
+{
+    for_each_instruction_set([] {
+        for (std::size_t length = 0; length < 80; ++length)
+        {
+            std::string input = "\"" + std::string(length, 'a');
+            decoder_type decoder(input);
+            TRIAL_PROTOCOL_TEST_EQUAL(decoder.code(), token::detail::code::error_unexpected_token);
+        }
+    });
+}
+
+void run()
+{
+    test_long_whitespaces();
+    test_long_string();
+    test_long_string_escape();
+    test_long_string_utf8();
+    fail_long_string_control();
+    fail_long_string_unterminated();
+}
+
+} // namespace simd_suite
+
 //-----------------------------------------------------------------------------
 // main
 //-----------------------------------------------------------------------------
@@ -2041,6 +2422,7 @@ int main()
     pangram_suite::run();
     container_suite::run();
     view_suite::run();
+    simd_suite::run();
 
     return boost::report_errors();
 }
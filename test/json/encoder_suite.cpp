@@ -8,15 +8,20 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <cmath>
+#include <cstring>
 #include <sstream>
+#include <string>
 #include <limits>
 #include <functional>
 #include <trial/protocol/core/char_traits.hpp>
+#include <trial/protocol/core/detail/simd.hpp>
 #include <trial/protocol/buffer/array.hpp>
 #include <trial/protocol/buffer/ostream.hpp>
 #include <trial/protocol/buffer/vector.hpp>
 #include <trial/protocol/buffer/string.hpp>
 #include <trial/protocol/json/detail/encoder.hpp>
+#include <trial/protocol/json/detail/real_decoder.hpp>
 #include <trial/protocol/core/detail/lightweight_test.hpp>
 
 using namespace trial::protocol;
@@ -330,6 +335,90 @@ void regress_digits10()
     TRIAL_PROTOCOL_TEST_EQUAL(result.str(), "1561718168");
 }
 
+void test_powers_of_ten()
+{
+    // Digit count boundaries
+    std::uint64_t power = 1;
+    for (int exponent = 0; exponent < 20; ++exponent)
+    {
+        for (std::uint64_t value : { power - 1, power, power + 1 })
+        {
+            std::ostringstream result;
+            encoder_type encoder(result);
+            const std::string expected = std::to_string(value);
+            TRIAL_PROTOCOL_TEST_EQUAL(encoder.value(value), expected.size());
+            TRIAL_PROTOCOL_TEST_EQUAL(result.str(), expected);
+        }
+        if (power <= std::numeric_limits<std::int64_t>::max() / 10)
+        {
+            std::ostringstream result;
+            encoder_type encoder(result);
+            const std::int64_t value = -std::int64_t(power);
+            const std::string expected = std::to_string(value);
+            TRIAL_PROTOCOL_TEST_EQUAL(encoder.value(value), expected.size());
+            TRIAL_PROTOCOL_TEST_EQUAL(result.str(), expected);
+        }
+        power *= 10;
+    }
+}
+
+template <typename T>
+void check_limits()
+{
+    for (T value : { std::numeric_limits<T>::min(), std::numeric_limits<T>::max() })
+    {
+        std::ostringstream result;
+        encoder_type encoder(result);
+        const std::string expected = std::to_string(value);
+        TRIAL_PROTOCOL_TEST_EQUAL(encoder.value(value), expected.size());
+        TRIAL_PROTOCOL_TEST_EQUAL(result.str(), expected);
+    }
+}
+
+void test_limits()
+{
+    check_limits<signed char>();
+    check_limits<unsigned char>();
+    check_limits<short>();
+    check_limits<unsigned short>();
+    check_limits<int>();
+    check_limits<unsigned int>();
+    check_limits<long>();
+    check_limits<unsigned long>();
+    check_limits<long long>();
+    check_limits<unsigned long long>();
+}
+
+#if defined(__SIZEOF_INT128__) && !defined(__STRICT_ANSI__)
+
+void regress_int128()
+{
+    // Integers wider than 64 bits must not be truncated
+    {
+        std::ostringstream result;
+        encoder_type encoder(result);
+        __extension__ const __int128 value = __int128(1) << 100;
+        TRIAL_PROTOCOL_TEST_EQUAL(encoder.value(value), 31);
+        TRIAL_PROTOCOL_TEST_EQUAL(result.str(), "1267650600228229401496703205376");
+    }
+    {
+        std::ostringstream result;
+        encoder_type encoder(result);
+        __extension__ const __int128 value = std::numeric_limits<__int128>::min();
+        TRIAL_PROTOCOL_TEST_EQUAL(encoder.value(value), 40);
+        TRIAL_PROTOCOL_TEST_EQUAL(result.str(), "-170141183460469231731687303715884105728");
+    }
+    {
+        std::ostringstream result;
+        encoder_type encoder(result);
+        __extension__ const unsigned __int128 value = std::numeric_limits<unsigned __int128>::max();
+        TRIAL_PROTOCOL_TEST_EQUAL(encoder.value(value), 39);
+        TRIAL_PROTOCOL_TEST_EQUAL(result.str(), "340282366920938463463374607431768211455");
+    }
+}
+
+#endif
+
 void run()
 {
     test_zero();
@@ -348,6 +437,11 @@ void run()
     test_almost_min();
     test_min();
     regress_digits10();
+    test_powers_of_ten();
+    test_limits();
+#if defined(__SIZEOF_INT128__) && !defined(__STRICT_ANSI__)
+    regress_int128();
+#endif
 }
 
 } // namespace integer_suite
@@ -541,6 +635,148 @@ void run()
 
 } // namespace number_suite
 
+//-----------------------------------------------------------------------------
+// Shortest number
+//-----------------------------------------------------------------------------
+
+namespace shortest_suite
+{
+
+template <typename T>
+std::string encode(T value)
+{
+    std::ostringstream result;
+    encoder_type encoder(result, json::real_format::shortest);
+    const std::size_t size = encoder.value(value);
+    TRIAL_PROTOCOL_TEST_EQUAL(size, result.str().size());
+    return result.str();
+}
+
+void test_zero()
+{
+    TRIAL_PROTOCOL_TEST_EQUAL(encode(0.0f), "0.0");
+    TRIAL_PROTOCOL_TEST_EQUAL(encode(0.0), "0.0");
+    TRIAL_PROTOCOL_TEST_EQUAL(encode(-0.0), "-0.0");
+    TRIAL_PROTOCOL_TEST_EQUAL(encode(0.0L), "0.0");
+}
+
+void test_integral()
+{
+    TRIAL_PROTOCOL_TEST_EQUAL(encode(1.0), "1.0");
+    TRIAL_PROTOCOL_TEST_EQUAL(encode(-1.0), "-1.0");
+    TRIAL_PROTOCOL_TEST_EQUAL(encode(42.0f), "42.0");
+    TRIAL_PROTOCOL_TEST_EQUAL(encode(1e14), "100000000000000.0");
+    TRIAL_PROTOCOL_TEST_EQUAL(encode(1e15), "1e+15");
+    TRIAL_PROTOCOL_TEST_EQUAL(encode(1.0L), "1.0");
+}
+
+void test_fraction()
+{
+    TRIAL_PROTOCOL_TEST_EQUAL(encode(0.5), "0.5");
+    TRIAL_PROTOCOL_TEST_EQUAL(encode(-0.5), "-0.5");
+    TRIAL_PROTOCOL_TEST_EQUAL(encode(0.1), "0.1");
+    TRIAL_PROTOCOL_TEST_EQUAL(encode(0.1f), "0.1");
+    TRIAL_PROTOCOL_TEST_EQUAL(encode(0.3), "0.3");
+    TRIAL_PROTOCOL_TEST_EQUAL(encode(0.1 + 0.2), "0.30000000000000004");
+    TRIAL_PROTOCOL_TEST_EQUAL(encode(3.14159), "3.14159");
+    TRIAL_PROTOCOL_TEST_EQUAL(encode(0.0001), "0.0001");
+    TRIAL_PROTOCOL_TEST_EQUAL(encode(0.00001), "1e-05");
+}
+
+void test_exponent()
+{
+    TRIAL_PROTOCOL_TEST_EQUAL(encode(1e100), "1e+100");
+    TRIAL_PROTOCOL_TEST_EQUAL(encode(1e-100), "1e-100");
+    TRIAL_PROTOCOL_TEST_EQUAL(encode(1.5e300), "1.5e+300");
+    TRIAL_PROTOCOL_TEST_EQUAL(encode(-2.5e-20f), "-2.5e-20");
+}
+
+void test_limits()
+{
+    TRIAL_PROTOCOL_TEST_EQUAL(encode(std::numeric_limits<float>::max()), "3.4028235e+38");
+    TRIAL_PROTOCOL_TEST_EQUAL(encode(std::numeric_limits<float>::min()), "1.1754944e-38");
+    TRIAL_PROTOCOL_TEST_EQUAL(encode(std::numeric_limits<double>::max()), "1.7976931348623157e+308");
+    TRIAL_PROTOCOL_TEST_EQUAL(encode(std::numeric_limits<double>::min()), "2.2250738585072014e-308");
+}
+
+void test_not_finite()
+{
+    TRIAL_PROTOCOL_TEST_EQUAL(encode(std::numeric_limits<double>::infinity()), "null");
+    TRIAL_PROTOCOL_TEST_EQUAL(encode(-std::numeric_limits<float>::infinity()), "null");
+    TRIAL_PROTOCOL_TEST_EQUAL(encode(std::numeric_limits<double>::quiet_NaN()), "null");
+}
+
+template <typename T, typename Bits>
+void round_trip(Bits bits)
+{
+    T value;
+    std::memcpy(&value, &bits, sizeof(value));
+    if (!std::isfinite(value))
+        return;
+    const std::string output = encode(value);
+    const T result = json::detail::real_decoder<char, T>::decode(output);
+    TRIAL_PROTOCOL_TEST_EQUAL(std::memcmp(&result, &value, sizeof(value)), 0);
+}
+
+void test_round_trip()
+{
+    // Boundaries of the binary exponent ranges and subnormals
+    round_trip<double>(UINT64_C(0x0000000000000001));
+    round_trip<double>(UINT64_C(0x000FFFFFFFFFFFFF));
+    round_trip<double>(UINT64_C(0x0010000000000000));
+    round_trip<double>(UINT64_C(0x4340000000000000));
+    round_trip<float>(UINT32_C(0x00000001));
+    round_trip<float>(UINT32_C(0x007FFFFF));
+    round_trip<float>(UINT32_C(0x00800000));
+
+    std::uint64_t state = UINT64_C(0x9E3779B97F4A7C15);
+    for (int i = 0; i < 100000; ++i)
+    {
+        // xorshift64
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        round_trip<double>(state);
+        round_trip<float>(std::uint32_t(state >> 32));
+    }
+}
+
+void test_long_double()
+{
+    using decoder = json::detail::real_decoder<char, long double>;
+    const long double value = 0.1L;
+    const std::string output = encode(value);
+    TRIAL_PROTOCOL_TEST_EQUAL(decoder::decode(output), value);
+}
+
+void test_unsigned()
+{
+#if defined(TRIAL_PROTOCOL_JSON_WITH_UNSIGNED_CHAR)
+    unsigned_ostringstream buffer;
+    unsigned_encoder_type encoder(buffer, json::real_format::shortest);
+    TRIAL_PROTOCOL_TEST_EQUAL(encoder.value(-0.25), 5);
+    unsigned char expect[] = { '-', '0', '.', '2', '5' };
+    unsigned_string result = buffer.str();
+    TRIAL_PROTOCOL_TEST_ALL_EQUAL(result.begin(), result.end(),
+                                  expect, expect + sizeof(expect));
+#endif
+}
+
+void run()
+{
+    test_zero();
+    test_integral();
+    test_fraction();
+    test_exponent();
+    test_limits();
+    test_not_finite();
+    test_round_trip();
+    test_long_double();
+    test_unsigned();
+}
+
+} // namespace shortest_suite
+
 //-----------------------------------------------------------------------------
 // String
 //-----------------------------------------------------------------------------
@@ -859,6 +1095,111 @@ void run()
 
 } // namespace string_suite
 
+//-----------------------------------------------------------------------------
+// Vectorized escaping
+//-----------------------------------------------------------------------------
+
+namespace simd_suite
+{
+
+namespace simd = trial::protocol::core::detail::simd;
+
+// Run all tests for each instruction set supported by the processor
+template <typename Function>
+void for_each_instruction_set(Function function)
+{
+    const simd::instruction_set best = simd::detect();
+    const simd::instruction_set candidates[] = { simd::instruction_set::scalar,
+                                                 simd::instruction_set::sse2,
+                                                 simd::instruction_set::avx2 };
+    for (auto isa : candidates)
+    {
+        if (isa > best)
+            break;
+        simd::selected() = isa;
+        function();
+    }
+    simd::selected() = best;
+}
+
+void test_long_string()
+{
+    for_each_instruction_set([] {
+        for (std::size_t length = 0; length < 80; ++length)
+        {
+            std::ostringstream result;
+            std::string text(length, 'a');
+            encoder_type encoder(result);
+            TRIAL_PROTOCOL_TEST_EQUAL(encoder.value(text), length + 2);
+            TRIAL_PROTOCOL_TEST_EQUAL(result.str(), "\"" + text + "\"");
+        }
+    });
+}
+
+void test_long_string_escape()
+{
+    const char escapes[] = "\"\\/\b\f\n\r\t";
+    const char *expected_escapes[] = { "\\\"", "\\\\", "\\/", "\\b", "\\f", "\\n", "\\r", "\\t" };
+    for_each_instruction_set([&] {
+        for (std::size_t kind = 0; kind < sizeof(escapes) - 1; ++kind)
+        {
+            for (std::size_t position = 0; position < 70; ++position)
+            {
+                std::ostringstream result;
+                std::string text(70, 'a');
+                text[position] = escapes[kind];
+                encoder_type encoder(result);
+                TRIAL_PROTOCOL_TEST_EQUAL(encoder.value(text), 73);
+                std::string expected = "\"" + std::string(70, 'a') + "\"";
+                expected.replace(1 + position, 1, expected_escapes[kind]);
+                TRIAL_PROTOCOL_TEST_EQUAL(result.str(), expected);
+            }
+        }
+    });
+}
+
+void test_long_string_utf8()
+{
+    for_each_instruction_set([] {
+        for (std::size_t position = 0; position < 40; ++position)
+        {
+            std::ostringstream result;
+            std::string text(40, 'a');
+            text.insert(position, "\xC3\xA6\xE2\x82\xAC");
+            encoder_type encoder(result);
+            TRIAL_PROTOCOL_TEST_EQUAL(encoder.value(text), text.size() + 2);
+            TRIAL_PROTOCOL_TEST_EQUAL(result.str(), "\"" + text + "\"");
+        }
+    });
+}
+
+void test_long_string_sanitize()
+{
+    for_each_instruction_set([] {
+        for (std::size_t position = 0; position < 40; ++position)
+        {
+            std::ostringstream result;
+            std::string text(40, 'a');
+            text[position] = '\xFF';
+            encoder_type encoder(result);
+            encoder.value(text);
+            std::string expected = "\"" + text + "\"";
+            expected[1 + position] = '?';
+            TRIAL_PROTOCOL_TEST_EQUAL(result.str(), expected);
+        }
+    });
+}
+
+void run()
+{
+    test_long_string();
+    test_long_string_escape();
+    test_long_string_utf8();
+    test_long_string_sanitize();
+}
+
+} // namespace simd_suite
+
 //-----------------------------------------------------------------------------
 // Container
 //-----------------------------------------------------------------------------
@@ -1024,7 +1365,9 @@ int main()
     basic_suite::run();
     integer_suite::run();
     number_suite::run();
+    shortest_suite::run();
     string_suite::run();
+    simd_suite::run();
     container_suite::run();
     literal_suite::run();
 
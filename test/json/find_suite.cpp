@@ -0,0 +1,279 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <vector>
+#include <trial/protocol/json/partial/find.hpp>
+#include <trial/protocol/core/detail/lightweight_test.hpp>
+
+using namespace trial::protocol;
+namespace token = json::token;
+
+const char document[] = R"({
+    "alpha": { "bravo": [ 10, 11, { "charlie": true } ] },
+    "a/b": 1,
+    "m~n": 2,
+    "": 3,
+    "delta": [ { "echo": "one" }, { "echo": "two" }, { "foxtrot": 0 } ],
+    "golf": "hæ"
+})";
+
+//-----------------------------------------------------------------------------
+// JSON Pointer
+//-----------------------------------------------------------------------------
+
+namespace pointer_suite
+{
+
+void find_root()
+{
+    json::reader reader(document);
+    TRIAL_PROTOCOL_TEST(json::partial::find(reader, ""));
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::begin_object);
+}
+
+void find_member()
+{
+    json::reader reader(document);
+    TRIAL_PROTOCOL_TEST(json::partial::find(reader, "/alpha"));
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::begin_object);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.level(), 1);
+}
+
+void find_nested()
+{
+    json::reader reader(document);
+    TRIAL_PROTOCOL_TEST(json::partial::find(reader, "/alpha/bravo/1"));
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.value<int>(), 11);
+}
+
+void find_deep()
+{
+    json::reader reader(document);
+    TRIAL_PROTOCOL_TEST(json::partial::find(reader, "/alpha/bravo/2/charlie"));
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.value<bool>(), true);
+}
+
+void find_escaped()
+{
+    {
+        json::reader reader(document);
+        TRIAL_PROTOCOL_TEST(json::partial::find(reader, "/a~1b"));
+        TRIAL_PROTOCOL_TEST_EQUAL(reader.value<int>(), 1);
+    }
+    {
+        json::reader reader(document);
+        TRIAL_PROTOCOL_TEST(json::partial::find(reader, "/m~0n"));
+        TRIAL_PROTOCOL_TEST_EQUAL(reader.value<int>(), 2);
+    }
+    {
+        json::reader reader(document);
+        TRIAL_PROTOCOL_TEST(json::partial::find(reader, "/"));
+        TRIAL_PROTOCOL_TEST_EQUAL(reader.value<int>(), 3);
+    }
+}
+
+void find_escaped_key()
+{
+    const char input[] = R"({"al\u0070ha":42})";
+    json::reader reader(input);
+    TRIAL_PROTOCOL_TEST(json::partial::find(reader, "/alpha"));
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.value<int>(), 42);
+}
+
+void find_then_continue()
+{
+    json::reader reader(document);
+    TRIAL_PROTOCOL_TEST(json::partial::find(reader, "/delta/1"));
+    // Reader continues from the found value
+    TRIAL_PROTOCOL_TEST(json::partial::find(reader, "/echo"));
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.value<std::string>(), "two");
+}
+
+void find_missing()
+{
+    {
+        json::reader reader(document);
+        TRIAL_PROTOCOL_TEST(!json::partial::find(reader, "/zulu"));
+    }
+    {
+        json::reader reader(document);
+        TRIAL_PROTOCOL_TEST(!json::partial::find(reader, "/alpha/bravo/3"));
+    }
+    {
+        json::reader reader(document);
+        TRIAL_PROTOCOL_TEST(!json::partial::find(reader, "/alpha/bravo/-"));
+    }
+    {
+        json::reader reader(document);
+        TRIAL_PROTOCOL_TEST(!json::partial::find(reader, "/alpha/bravo/01"));
+    }
+    {
+        json::reader reader(document);
+        TRIAL_PROTOCOL_TEST(!json::partial::find(reader, "/golf/0"));
+    }
+}
+
+void fail_pointer()
+{
+    {
+        json::reader reader(document);
+        std::error_code ec;
+        TRIAL_PROTOCOL_TEST(!json::partial::find(reader, "alpha", ec));
+        TRIAL_PROTOCOL_TEST_EQUAL(ec, json::errc::invalid_path);
+    }
+    {
+        json::reader reader(document);
+        std::error_code ec;
+        TRIAL_PROTOCOL_TEST(!json::partial::find(reader, "/m~2n", ec));
+        TRIAL_PROTOCOL_TEST_EQUAL(ec, json::errc::invalid_path);
+    }
+    {
+        json::reader reader(document);
+        TRIAL_PROTOCOL_TEST_THROW_EQUAL(json::partial::find(reader, "/alpha~"),
+                                        json::error, "invalid path expression");
+    }
+}
+
+void fail_input()
+{
+    json::reader reader(R"({"alpha": [1,, 2], "bravo": 3})");
+    std::error_code ec;
+    TRIAL_PROTOCOL_TEST(!json::partial::find(reader, "/bravo", ec));
+    TRIAL_PROTOCOL_TEST(bool(ec));
+}
+
+void run()
+{
+    find_root();
+    find_member();
+    find_nested();
+    find_deep();
+    find_escaped();
+    find_escaped_key();
+    find_then_continue();
+    find_missing();
+    fail_pointer();
+    fail_input();
+}
+
+} // namespace pointer_suite
+
+//-----------------------------------------------------------------------------
+// JSONPath
+//-----------------------------------------------------------------------------
+
+namespace path_suite
+{
+
+std::vector<std::string> select(const char *input, const char *path)
+{
+    json::reader reader(input);
+    std::vector<std::string> result;
+    for (const auto& view : json::partial::select(reader, path))
+    {
+        result.emplace_back(view.data(), view.size());
+    }
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::end);
+    return result;
+}
+
+void select_root()
+{
+    auto result = select("[1,2]", "$");
+    TRIAL_PROTOCOL_TEST_EQUAL(result.size(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[0], "[1,2]");
+}
+
+void select_member()
+{
+    auto result = select(document, "$.alpha.bravo");
+    TRIAL_PROTOCOL_TEST_EQUAL(result.size(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[0], R"([ 10, 11, { "charlie": true } ])");
+}
+
+void select_bracket()
+{
+    auto result = select(document, "$['alpha'][\"bravo\"][0]");
+    TRIAL_PROTOCOL_TEST_EQUAL(result.size(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[0], "10");
+
+    result = select(document, "$['a/b']");
+    TRIAL_PROTOCOL_TEST_EQUAL(result.size(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[0], "1");
+}
+
+void select_wildcard()
+{
+    auto result = select(document, "$.delta[*].echo");
+    TRIAL_PROTOCOL_TEST_EQUAL(result.size(), 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[0], "\"one\"");
+    TRIAL_PROTOCOL_TEST_EQUAL(result[1], "\"two\"");
+
+    result = select(document, "$.alpha.bravo.*");
+    TRIAL_PROTOCOL_TEST_EQUAL(result.size(), 3);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[2], R"({ "charlie": true })");
+
+    result = select(R"({"a":{"x":1},"b":{"x":2},"c":3})", "$.*.x");
+    TRIAL_PROTOCOL_TEST_EQUAL(result.size(), 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[0], "1");
+    TRIAL_PROTOCOL_TEST_EQUAL(result[1], "2");
+}
+
+void select_missing()
+{
+    TRIAL_PROTOCOL_TEST(select(document, "$.zulu").empty());
+    TRIAL_PROTOCOL_TEST(select(document, "$.alpha[0]").empty());
+    TRIAL_PROTOCOL_TEST(select(document, "$.delta.echo").empty());
+    TRIAL_PROTOCOL_TEST(select(document, "$.golf.hotel").empty());
+}
+
+void fail_path()
+{
+    const char *paths[] = { "", "alpha", "$.", "$[", "$[1", "$['alpha'", "$[x]", "$..alpha" };
+    for (auto path : paths)
+    {
+        json::reader reader(document);
+        std::error_code ec;
+        TRIAL_PROTOCOL_TEST(json::partial::select(reader, path, ec).empty());
+        TRIAL_PROTOCOL_TEST_EQUAL(ec, json::errc::invalid_path);
+    }
+}
+
+void fail_input()
+{
+    json::reader reader("[1,2,}");
+    TRIAL_PROTOCOL_TEST_THROWS(json::partial::select(reader, "$[*]"), json::error);
+}
+
+void run()
+{
+    select_root();
+    select_member();
+    select_bracket();
+    select_wildcard();
+    select_missing();
+    fail_path();
+    fail_input();
+}
+
+} // namespace path_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    pointer_suite::run();
+    path_suite::run();
+
+    return boost::report_errors();
+}
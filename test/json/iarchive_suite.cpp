@@ -248,10 +248,22 @@ void test_escape_solidus()
     TRIAL_PROTOCOL_TEST_EQUAL(value, "/");
 }
 
+void test_in_situ()
+{
+    char input[] = "[\"al\\u0070ha\",\"bra\\\\vo\"]";
+    json::iarchive in(json::reader(json::in_situ, input, sizeof(input) - 1));
+    std::vector<std::string> value;
+    TRIAL_PROTOCOL_TEST_NO_THROW(in >> value);
+    TRIAL_PROTOCOL_TEST_EQUAL(value.size(), 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(value[0], "alpha");
+    TRIAL_PROTOCOL_TEST_EQUAL(value[1], "bra\\vo");
+}
+
 void run()
 {
     test_empty();
     test_alpha();
+    test_in_situ();
     test_escape_quote();
     test_escape_reverse_solidus();
     test_escape_solidus();
@@ -0,0 +1,150 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <stdexcept>
+#include <string>
+#include <trial/dynamic/flat_variable.hpp>
+#include <trial/protocol/json/lazy.hpp>
+#include <trial/protocol/core/detail/lightweight_test.hpp>
+
+using namespace trial::dynamic;
+using namespace trial::protocol;
+
+//-----------------------------------------------------------------------------
+
+namespace lazy_suite
+{
+
+void test_scalar()
+{
+    json::lazy value("  42 ");
+    TRIAL_PROTOCOL_TEST_EQUAL(value.symbol(), json::token::symbol::integer);
+    TRIAL_PROTOCOL_TEST_EQUAL(value.literal(), "42");
+    TRIAL_PROTOCOL_TEST_EQUAL(value.value().value<int>(), 42);
+}
+
+void test_array()
+{
+    json::lazy value("[ 1, [ 2, 3 ], { \"alpha\": null }, \"bravo\" ]");
+    TRIAL_PROTOCOL_TEST_EQUAL(value.symbol(), json::token::symbol::begin_array);
+    TRIAL_PROTOCOL_TEST_EQUAL(value.size(), 4);
+    TRIAL_PROTOCOL_TEST_EQUAL(value[0].literal(), "1");
+    TRIAL_PROTOCOL_TEST_EQUAL(value[1].literal(), "[ 2, 3 ]");
+    TRIAL_PROTOCOL_TEST_EQUAL(value[1].size(), 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(value[1][1].value().value<int>(), 3);
+    TRIAL_PROTOCOL_TEST_EQUAL(value[2].symbol(), json::token::symbol::begin_object);
+    TRIAL_PROTOCOL_TEST(value[2]["alpha"].value().same<nullable>());
+    TRIAL_PROTOCOL_TEST_EQUAL(value[3].value().value<string>(), "bravo");
+}
+
+void test_array_empty()
+{
+    json::lazy value("[]");
+    TRIAL_PROTOCOL_TEST_EQUAL(value.size(), 0);
+    TRIAL_PROTOCOL_TEST(value.value() == array::make());
+}
+
+void test_object()
+{
+    json::lazy value("{ \"alpha\": { \"bravo\": [ 1, 2 ] }, \"ch\\u0061rlie\": true }");
+    TRIAL_PROTOCOL_TEST_EQUAL(value.size(), 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(value.count("alpha"), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(value.count("charlie"), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(value.count("delta"), 0);
+    TRIAL_PROTOCOL_TEST_EQUAL(value["alpha"].literal(), "{ \"bravo\": [ 1, 2 ] }");
+    TRIAL_PROTOCOL_TEST(value["alpha"]["bravo"].value() == array::make({ 1, 2 }));
+    TRIAL_PROTOCOL_TEST_EQUAL(value["charlie"].value().value<bool>(), true);
+}
+
+void test_value()
+{
+    std::string input = "{ \"alpha\": [ 1, 2.0 ], \"bravo\": { \"charlie\": \"delta\" } }";
+    json::lazy value(input);
+    TRIAL_PROTOCOL_TEST(value.value() == json::parse(input));
+}
+
+void test_flat()
+{
+    json::basic_lazy<flat_allocator> value("{ \"alpha\": { \"charlie\": 3, \"bravo\": 2 } }");
+    auto result = value["alpha"].value();
+    static_assert(std::is_same<decltype(result), flat_variable>::value, "flat_variable");
+    TRIAL_PROTOCOL_TEST_EQUAL((*result.key_begin()).value<string>(), "bravo");
+}
+
+void test_skipped_unvalidated()
+{
+    // Invalid content is only detected when decoded
+    json::lazy value("[ 1, [ 2, ] ]");
+    TRIAL_PROTOCOL_TEST_EQUAL(value.size(), 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(value[0].value().value<int>(), 1);
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(value[1].value(),
+                                    json::error,
+                                    "expected end array bracket");
+}
+
+void fail_empty()
+{
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(json::lazy(""),
+                                    json::error,
+                                    "unexpected token");
+}
+
+void fail_unterminated()
+{
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(json::lazy("[ 1, 2"),
+                                    json::error,
+                                    "algorithm used requires more tokens than available");
+}
+
+void fail_incompatible()
+{
+    json::lazy value("[ 1 ]");
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(value["alpha"],
+                                    json::error,
+                                    "incompatible type");
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(value[0].size(),
+                                    json::error,
+                                    "incompatible type");
+}
+
+void fail_out_of_range()
+{
+    json::lazy value("{ \"alpha\": [ 1 ] }");
+    TRIAL_PROTOCOL_TEST_THROWS(value["bravo"], std::out_of_range);
+    TRIAL_PROTOCOL_TEST_THROWS(value["alpha"][1], std::out_of_range);
+}
+
+void run()
+{
+    test_scalar();
+    test_array();
+    test_array_empty();
+    test_object();
+    test_value();
+    test_flat();
+    test_skipped_unvalidated();
+    fail_empty();
+    fail_unterminated();
+    fail_incompatible();
+    fail_out_of_range();
+}
+
+} // namespace lazy_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    lazy_suite::run();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,104 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <trial/protocol/json/line_reader.hpp>
+#include <trial/protocol/json/parse.hpp>
+#include <trial/protocol/core/detail/lightweight_test.hpp>
+
+using namespace trial::protocol;
+
+//-----------------------------------------------------------------------------
+
+namespace line_suite
+{
+
+void test_empty()
+{
+    json::line_reader lines("");
+    TRIAL_PROTOCOL_TEST_EQUAL(lines.next(), false);
+    TRIAL_PROTOCOL_TEST_EQUAL(lines.literal(), "");
+}
+
+void test_blank()
+{
+    json::line_reader lines(" \n\t\r\n  \n");
+    TRIAL_PROTOCOL_TEST_EQUAL(lines.next(), false);
+}
+
+void test_one()
+{
+    json::line_reader lines("{\"alpha\":1}");
+    TRIAL_PROTOCOL_TEST_EQUAL(lines.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(lines.literal(), "{\"alpha\":1}");
+    TRIAL_PROTOCOL_TEST_EQUAL(lines.next(), false);
+}
+
+void test_one_terminated()
+{
+    json::line_reader lines("{\"alpha\":1}\n");
+    TRIAL_PROTOCOL_TEST_EQUAL(lines.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(lines.literal(), "{\"alpha\":1}");
+    TRIAL_PROTOCOL_TEST_EQUAL(lines.tail(), "\n");
+    TRIAL_PROTOCOL_TEST_EQUAL(lines.next(), false);
+}
+
+void test_many()
+{
+    json::line_reader lines("1\n[2]\n\n  \"three\"\r\n{}");
+    TRIAL_PROTOCOL_TEST_EQUAL(lines.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(lines.literal(), "1");
+    TRIAL_PROTOCOL_TEST_EQUAL(lines.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(lines.literal(), "[2]");
+    TRIAL_PROTOCOL_TEST_EQUAL(lines.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(lines.literal(), "\"three\"\r");
+    TRIAL_PROTOCOL_TEST_EQUAL(lines.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(lines.literal(), "{}");
+    TRIAL_PROTOCOL_TEST_EQUAL(lines.next(), false);
+}
+
+void test_reader()
+{
+    json::line_reader lines("[1, 2]\n\"alpha\"\n");
+    TRIAL_PROTOCOL_TEST_EQUAL(lines.next(), true);
+    {
+        json::reader reader(lines.literal());
+        TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), json::token::symbol::begin_array);
+    }
+    TRIAL_PROTOCOL_TEST_EQUAL(lines.next(), true);
+    {
+        auto result = json::parse(lines.literal());
+        TRIAL_PROTOCOL_TEST_EQUAL(result.value<std::string>(), "alpha");
+    }
+    TRIAL_PROTOCOL_TEST_EQUAL(lines.next(), false);
+}
+
+void run()
+{
+    test_empty();
+    test_blank();
+    test_one();
+    test_one_terminated();
+    test_many();
+    test_reader();
+}
+
+} // namespace line_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    line_suite::run();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,278 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <atomic>
+#include <string>
+#include <trial/dynamic/flat_variable.hpp>
+#include <trial/protocol/json/parallel_parse.hpp>
+#include <trial/protocol/core/detail/lightweight_test.hpp>
+
+using namespace trial::dynamic;
+using namespace trial::protocol;
+
+//-----------------------------------------------------------------------------
+
+namespace parser_suite
+{
+
+void parse_array_empty()
+{
+    std::string input = "[]";
+    auto result = json::parallel_parse(input, 4);
+    TRIAL_PROTOCOL_TEST(result.is<array>());
+    TRIAL_PROTOCOL_TEST_EQUAL(result.size(), 0);
+}
+
+void parse_array_scalars()
+{
+    std::string input = "[ null, true, 2, 3.0, \"alpha\" ]";
+    auto result = json::parallel_parse(input, 4);
+    TRIAL_PROTOCOL_TEST(result.is<array>());
+    TRIAL_PROTOCOL_TEST_EQUAL(result.size(), 5);
+    TRIAL_PROTOCOL_TEST(result[0].same<nullable>());
+    TRIAL_PROTOCOL_TEST_EQUAL(result[1].value<bool>(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[2].value<int>(), 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[3].value<double>(), 3.0);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[4].value<string>(), "alpha");
+}
+
+void parse_array_records()
+{
+    std::string input = "[";
+    for (int i = 0; i < 100; ++i)
+    {
+        if (i > 0)
+            input += ",";
+        input += "{ \"key\": " + std::to_string(i) + ", \"value\": [ \"" + std::string(i % 7, 'x') + "\", { \"nested\": [] } ] }";
+    }
+    input += "]";
+
+    auto result = json::parallel_parse(input, 8);
+    TRIAL_PROTOCOL_TEST(result == json::parse(input));
+    TRIAL_PROTOCOL_TEST_EQUAL(result.size(), 100);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[99]["key"].value<int>(), 99);
+}
+
+void parse_array_more_threads()
+{
+    std::string input = "[ 1, 2 ]";
+    auto result = json::parallel_parse(input, 32);
+    TRIAL_PROTOCOL_TEST(result == array::make({ 1, 2 }));
+}
+
+void parse_array_one_thread()
+{
+    std::string input = "[ 1, [ 2 ] ]";
+    auto result = json::parallel_parse(input, 1);
+    TRIAL_PROTOCOL_TEST(result == array::make({ 1, array::make({ 2 }) }));
+}
+
+void parse_object()
+{
+    std::string input = "{ \"alpha\": [ 1, 2 ] }";
+    auto result = json::parallel_parse(input, 4);
+    TRIAL_PROTOCOL_TEST(result.is<map>());
+    TRIAL_PROTOCOL_TEST_EQUAL(result["alpha"].size(), 2);
+}
+
+void parse_scalar()
+{
+    auto result = json::parallel_parse("42", 4);
+    TRIAL_PROTOCOL_TEST_EQUAL(result.value<int>(), 42);
+}
+
+void parse_flat()
+{
+    std::string input = "[ { \"bravo\": 2, \"alpha\": 1 }, { \"charlie\": 3 } ]";
+    auto result = json::parallel_parse<std::string, flat_allocator>(input, 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(result.size(), 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[0].key_begin()->value<int>(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[1]["charlie"].value<int>(), 3);
+}
+
+void parse_arena()
+{
+    std::string input = "[";
+    for (int i = 0; i < 100; ++i)
+    {
+        if (i > 0)
+            input += ",";
+        input += "{ \"key\": " + std::to_string(i) + ", \"value\": [ \"" + std::string(20 + i % 7, 'x') + "\" ] }";
+    }
+    input += "]";
+
+    using variable_type = basic_variable<core::arena_allocator>;
+    core::arena memory;
+    core::arena::scope scope(memory);
+    auto result = json::parallel_parse<std::string, core::arena_allocator>(input, 8);
+    TRIAL_PROTOCOL_TEST(result.assume_value<variable_type::array_type>().get_allocator().resource() == &memory);
+    TRIAL_PROTOCOL_TEST_EQUAL(result.size(), 100);
+    for (int i = 0; i < 100; ++i)
+    {
+        TRIAL_PROTOCOL_TEST_EQUAL(result[i]["key"].value<int>(), i);
+        TRIAL_PROTOCOL_TEST_EQUAL(result[i]["value"][0].value<variable_type::string_type>().size(), std::size_t(20 + i % 7));
+    }
+}
+
+void run()
+{
+    parse_array_empty();
+    parse_array_scalars();
+    parse_array_records();
+    parse_array_more_threads();
+    parse_array_one_thread();
+    parse_object();
+    parse_scalar();
+    parse_flat();
+    parse_arena();
+}
+
+} // namespace parser_suite
+
+//-----------------------------------------------------------------------------
+
+namespace failure_suite
+{
+
+void fail_array_begin()
+{
+    std::string input = "[";
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(json::parallel_parse(input, 4),
+                                    json::error,
+                                    "expected end array bracket");
+}
+
+void fail_array_unterminated()
+{
+    std::string input = "[ 1, [ 2 ]";
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(json::parallel_parse(input, 4),
+                                    json::error,
+                                    "expected end array bracket");
+}
+
+void fail_element()
+{
+    std::string input = "[ 1, { \"alpha\": 2 }, { 3: 4 } ]";
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(json::parallel_parse(input, 4),
+                                    json::error,
+                                    "expected end object bracket");
+}
+
+void fail_first_element()
+{
+    // Failure of the earliest element is reported
+    std::string input = "[ { 1: 2 }, [ 3, ], { 4: 5 } ]";
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(json::parallel_parse(input, 4),
+                                    json::error,
+                                    "expected end object bracket");
+}
+
+void fail_residue()
+{
+    std::string input = "[ 1 ] 2";
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(json::parallel_parse(input, 4),
+                                    json::error,
+                                    "unexpected token");
+}
+
+void run()
+{
+    fail_array_begin();
+    fail_array_unterminated();
+    fail_element();
+    fail_first_element();
+    fail_residue();
+}
+
+} // namespace failure_suite
+
+//-----------------------------------------------------------------------------
+// Newline-delimited documents
+//-----------------------------------------------------------------------------
+
+namespace lines_suite
+{
+
+using document_type = basic_variable<core::arena_allocator>;
+
+void parse_empty()
+{
+    std::atomic<int> count(0);
+    json::parallel_parse_lines("",
+                               [&count] (const document_type&) { ++count; },
+                               4);
+    TRIAL_PROTOCOL_TEST_EQUAL(count.load(), 0);
+}
+
+void parse_documents()
+{
+    std::string input;
+    for (int i = 0; i < 1000; ++i)
+    {
+        input += "{ \"key\": " + std::to_string(i) + ", \"value\": [ \"alpha\", true ] }\n";
+        if (i % 10 == 0)
+            input += "\n";
+    }
+
+    std::atomic<int> count(0);
+    std::atomic<int> sum(0);
+    json::parallel_parse_lines(input,
+                               [&count, &sum] (const document_type& document)
+                               {
+                                   if (document["value"].size() == 2)
+                                   {
+                                       ++count;
+                                       sum += document["key"].value<int>();
+                                   }
+                               },
+                               8);
+    TRIAL_PROTOCOL_TEST_EQUAL(count.load(), 1000);
+    TRIAL_PROTOCOL_TEST_EQUAL(sum.load(), 999 * 1000 / 2);
+}
+
+void parse_unterminated()
+{
+    std::atomic<int> count(0);
+    json::parallel_parse_lines("1\n2\n3",
+                               [&count] (const document_type&) { ++count; },
+                               2);
+    TRIAL_PROTOCOL_TEST_EQUAL(count.load(), 3);
+}
+
+void fail_document()
+{
+    std::string input = "1\n[2\n3\n";
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(json::parallel_parse_lines(input, [] (const document_type&) {}, 2),
+                                    json::error,
+                                    "expected end array bracket");
+}
+
+void run()
+{
+    parse_empty();
+    parse_documents();
+    parse_unterminated();
+    fail_document();
+}
+
+} // namespace lines_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    parser_suite::run();
+    failure_suite::run();
+    lines_suite::run();
+
+    return boost::report_errors();
+}
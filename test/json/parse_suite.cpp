@@ -11,9 +11,15 @@
 #include <limits>
 #include <sstream>
 #include <iomanip>
+#include <iterator>
+#include <type_traits>
 #include <trial/protocol/buffer/string.hpp>
+#include <trial/dynamic/flat_variable.hpp>
+#include <trial/dynamic/interned_variable.hpp>
 #include <trial/protocol/json/parse.hpp>
+#include <trial/protocol/json/format.hpp>
 #include <trial/protocol/core/detail/lightweight_test.hpp>
+#include "../counting_allocator.hpp"
 
 using namespace trial::dynamic;
 using namespace trial::protocol;
@@ -863,6 +869,233 @@ void run()
 
 } // namespace residue_suite
 
+//-----------------------------------------------------------------------------
+// Arena
+//-----------------------------------------------------------------------------
+
+namespace arena_suite
+{
+
+using variable_type = basic_variable<core::arena_allocator>;
+using string_type = variable_type::string_type;
+
+void parse_null()
+{
+    core::arena memory;
+    std::string input = "null";
+    auto result = json::parse(input, memory);
+    TRIAL_PROTOCOL_TEST(result.same<nullable>());
+}
+
+void parse_string()
+{
+    core::arena memory;
+    std::string input = "\"alpha bravo charlie delta echo foxtrot golf hotel\"";
+    auto result = json::parse(input, memory);
+    TRIAL_PROTOCOL_TEST(result.is<string_type>());
+    TRIAL_PROTOCOL_TEST_EQUAL(result.value<string_type>(), "alpha bravo charlie delta echo foxtrot golf hotel");
+    TRIAL_PROTOCOL_TEST(memory.capacity() > 0);
+}
+
+void parse_nested()
+{
+    core::arena memory;
+    std::string input = "{ \"alpha\": [ 1, 2.0, true, null ], \"bravo\": { \"charlie\": \"delta\" } }";
+    auto result = json::parse(input, memory);
+    TRIAL_PROTOCOL_TEST(result.is<map>());
+    TRIAL_PROTOCOL_TEST_EQUAL(result.size(), 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(result["alpha"].size(), 4);
+    TRIAL_PROTOCOL_TEST_EQUAL(result["alpha"][0].value<int>(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(result["alpha"][1].value<double>(), 2.0);
+    TRIAL_PROTOCOL_TEST_EQUAL(result["alpha"][2].value<bool>(), true);
+    TRIAL_PROTOCOL_TEST(result["alpha"][3].same<nullable>());
+    TRIAL_PROTOCOL_TEST_EQUAL(result["bravo"]["charlie"].value<string_type>(), "delta");
+    TRIAL_PROTOCOL_TEST(memory.capacity() > 0);
+    TRIAL_PROTOCOL_TEST(core::arena::current() == nullptr);
+}
+
+void parse_partial()
+{
+    core::arena memory;
+    json::reader reader("[ 1, 2 ] 3");
+    auto result = json::partial::parse(reader, memory);
+    TRIAL_PROTOCOL_TEST(result.is<array>());
+    TRIAL_PROTOCOL_TEST_EQUAL(result.size(), 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.literal(), "3");
+}
+
+void fail_residue()
+{
+    core::arena memory;
+    std::string input = "null,";
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(json::parse(input, memory),
+                                    json::error,
+                                    "unexpected token");
+    TRIAL_PROTOCOL_TEST(core::arena::current() == nullptr);
+}
+
+void run()
+{
+    parse_null();
+    parse_string();
+    parse_nested();
+    parse_partial();
+    fail_residue();
+}
+
+} // namespace arena_suite
+
+//-----------------------------------------------------------------------------
+// Flat map
+//-----------------------------------------------------------------------------
+
+namespace flat_suite
+{
+
+void parse_object()
+{
+    std::string input = "{ \"charlie\": 3, \"alpha\": { \"bravo\": [ 2 ] } }";
+    auto result = json::parse<std::string, flat_allocator>(input);
+    static_assert(std::is_same<decltype(result), flat_variable>::value, "flat_variable");
+    TRIAL_PROTOCOL_TEST(result.is<map>());
+    TRIAL_PROTOCOL_TEST_EQUAL(result.size(), 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(result["charlie"].value<int>(), 3);
+    TRIAL_PROTOCOL_TEST_EQUAL(result["alpha"]["bravo"][0].value<int>(), 2);
+    TRIAL_PROTOCOL_TEST(result.key_begin()->is<map>());
+}
+
+void run()
+{
+    parse_object();
+}
+
+} // namespace flat_suite
+
+//-----------------------------------------------------------------------------
+// Keys
+//-----------------------------------------------------------------------------
+
+namespace key_suite
+{
+
+using trial::protocol::test::allocations;
+using trial::protocol::test::reset_allocations;
+using trial::protocol::test::counting_allocator;
+
+void parse_short_keys()
+{
+    std::string input = "[";
+    for (int i = 0; i < 100; ++i)
+    {
+        if (i > 0)
+            input += ",";
+        input += "{ \"id\": " + std::to_string(i) + ", \"name\": \"alpha\", \"tags\": [] }";
+    }
+    input += "]";
+
+    reset_allocations();
+    auto result = json::parse<std::string, counting_allocator>(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(result.size(), 100);
+    // Short keys and values are stored without allocations
+    TRIAL_PROTOCOL_TEST_EQUAL(allocations().characters, 0);
+}
+
+std::string make_records(int count)
+{
+    std::string input = "[";
+    for (int i = 0; i < count; ++i)
+    {
+        if (i > 0)
+            input += ",";
+        input += "{ \"identification_number\": " + std::to_string(i) + ", \"description\\u0020text\": \"alpha\" }";
+    }
+    input += "]";
+    return input;
+}
+
+void parse_interned_keys()
+{
+    using string_type = interned_variable::string_type;
+
+    auto result = json::parse<std::string, interned_allocator>(make_records(10));
+    TRIAL_PROTOCOL_TEST_EQUAL(result.size(), 10);
+    TRIAL_PROTOCOL_TEST_EQUAL(result[9]["identification_number"].value<int>(), 9);
+    TRIAL_PROTOCOL_TEST(result[9]["description text"] == "alpha");
+
+    // Long keys of different records share storage
+    const auto& first = result[0].key_begin().key().assume_value<string_type>();
+    const auto& last = result[9].key_begin().key().assume_value<string_type>();
+    TRIAL_PROTOCOL_TEST(first == "description text");
+    TRIAL_PROTOCOL_TEST(first.shares(last));
+    TRIAL_PROTOCOL_TEST(std::next(result[0].key_begin()).key().assume_value<string_type>().shares(
+                            std::next(result[9].key_begin()).key().assume_value<string_type>()));
+}
+
+void parse_interned_pool()
+{
+    using string_type = interned_variable::string_type;
+
+    // Keys are shared across documents decoded with the same pool
+    string_pool pool;
+    auto alpha = json::parse(make_records(2), pool);
+    auto bravo = json::parse(make_records(3), pool);
+    TRIAL_PROTOCOL_TEST_EQUAL(pool.size(), 2);
+    TRIAL_PROTOCOL_TEST(alpha[0].key_begin().key().assume_value<string_type>().shares(
+                            bravo[2].key_begin().key().assume_value<string_type>()));
+    TRIAL_PROTOCOL_TEST(alpha[1] == bravo[1]);
+}
+
+void parse_interned_format()
+{
+    const std::string input = "{\"identification_number\":1,\"name\":\"alpha\"}";
+    auto result = json::parse<std::string, interned_allocator>(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(json::format<std::string>(result), input);
+}
+
+void run()
+{
+    parse_short_keys();
+    parse_interned_keys();
+    parse_interned_pool();
+    parse_interned_format();
+}
+
+} // namespace key_suite
+
+//-----------------------------------------------------------------------------
+// In situ
+//-----------------------------------------------------------------------------
+
+namespace in_situ_suite
+{
+
+void parse_object()
+{
+    std::string input = "{ \"al\\u0070ha\": [ \"bra\\tvo\", 2 ], \"charlie\": \"delta\" }";
+    auto result = json::parse(json::in_situ, &input[0], input.size());
+    TRIAL_PROTOCOL_TEST(result.is<map>());
+    TRIAL_PROTOCOL_TEST_EQUAL(result.size(), 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(result["alpha"][0].value<string>(), "bra\tvo");
+    TRIAL_PROTOCOL_TEST_EQUAL(result["alpha"][1].value<int>(), 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(result["charlie"].value<string>(), "delta");
+}
+
+void fail_residue()
+{
+    std::string input = "\"al\\u0070ha\" 2";
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(json::parse(json::in_situ, &input[0], input.size()),
+                                    json::error,
+                                    "unexpected token");
+}
+
+void run()
+{
+    parse_object();
+    fail_residue();
+}
+
+} // namespace in_situ_suite
+
 //-----------------------------------------------------------------------------
 // main
 //-----------------------------------------------------------------------------
@@ -873,6 +1106,10 @@ int main()
     partial_suite::run();
     failure_suite::run();
     residue_suite::run();
+    arena_suite::run();
+    flat_suite::run();
+    key_suite::run();
+    in_situ_suite::run();
 
     return boost::report_errors();
 }
@@ -893,6 +893,314 @@ void run()
 
 } // namespace object_suite
 
+//-----------------------------------------------------------------------------
+// String view
+//-----------------------------------------------------------------------------
+
+namespace string_view_suite
+{
+
+void test_empty()
+{
+    const char input[] = "\"\"";
+    json::reader reader(input);
+    std::string scratch;
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.string_view(scratch), "");
+}
+
+void test_unescaped()
+{
+    const char input[] = "\"alpha\"";
+    json::reader reader(input);
+    std::string scratch;
+    json::reader::view_type result = reader.string_view(scratch);
+    TRIAL_PROTOCOL_TEST_EQUAL(result, "alpha");
+    // View into input buffer
+    TRIAL_PROTOCOL_TEST(result.data() == input + 1);
+    TRIAL_PROTOCOL_TEST(scratch.empty());
+}
+
+void test_escaped()
+{
+    const char input[] = "\"al\\tpha\\u00E6\"";
+    json::reader reader(input);
+    std::string scratch;
+    json::reader::view_type result = reader.string_view(scratch);
+    TRIAL_PROTOCOL_TEST_EQUAL(result, "al\tpha\xC3\xA6");
+    TRIAL_PROTOCOL_TEST(result.data() == scratch.data());
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.value<std::string>(), "al\tpha\xC3\xA6");
+}
+
+void test_escaped_only()
+{
+    const char input[] = "\"\\\"\\\\\\/\\b\\f\\n\\r\\t\"";
+    json::reader reader(input);
+    std::string scratch;
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.string_view(scratch), "\"\\/\b\f\n\r\t");
+}
+
+void test_object()
+{
+    const char input[] = "{\"alpha\":\"hydrogen\",\"bra\\u0076o\":\"helium\"}";
+    json::reader reader(input);
+    std::string scratch;
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.string_view(scratch), "alpha");
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.string_view(scratch), "hydrogen");
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.string_view(scratch), "bravo");
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    // Previous unescaped content is replaced
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.string_view(scratch), "helium");
+    TRIAL_PROTOCOL_TEST_EQUAL(scratch, "bravo");
+}
+
+void fail_integer()
+{
+    const char input[] = "42";
+    json::reader reader(input);
+    std::string scratch;
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(reader.string_view(scratch),
+                                    json::error, "incompatible type");
+}
+
+void run()
+{
+    test_empty();
+    test_unescaped();
+    test_escaped();
+    test_escaped_only();
+    test_object();
+    fail_integer();
+}
+
+} // namespace string_view_suite
+
+//-----------------------------------------------------------------------------
+// In situ
+//-----------------------------------------------------------------------------
+
+namespace in_situ_suite
+{
+
+void test_unescaped()
+{
+    char input[] = "\"alpha\"";
+    json::reader reader(json::in_situ, input, sizeof(input) - 1);
+    std::string scratch;
+    json::reader::view_type result = reader.string_view(scratch);
+    TRIAL_PROTOCOL_TEST_EQUAL(result, "alpha");
+    TRIAL_PROTOCOL_TEST(result.data() == input + 1);
+}
+
+void test_escaped()
+{
+    char input[] = "\"al\\tpha\\u00E6\"";
+    json::reader reader(json::in_situ, input, sizeof(input) - 1);
+    std::string scratch;
+    json::reader::view_type result = reader.string_view(scratch);
+    TRIAL_PROTOCOL_TEST_EQUAL(result, "al\tpha\xC3\xA6");
+    // View into input buffer
+    TRIAL_PROTOCOL_TEST(result.data() == input + 1);
+    TRIAL_PROTOCOL_TEST(scratch.empty());
+    // Literal still spans the original token
+    TRIAL_PROTOCOL_TEST(reader.literal().data() == input);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.literal().size(), sizeof(input) - 1);
+    // Unescaped content is not unescaped again
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.string_view(scratch), "al\tpha\xC3\xA6");
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.value<std::string>(), "al\tpha\xC3\xA6");
+}
+
+void test_escaped_reverse_solidus()
+{
+    char input[] = "\"\\\\n\"";
+    json::reader reader(json::in_situ, input, sizeof(input) - 1);
+    std::string scratch;
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.string_view(scratch), "\\n");
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.string_view(scratch), "\\n");
+}
+
+void test_value()
+{
+    char input[] = "\"bra\\u0076o\"";
+    json::reader reader(json::in_situ, input, sizeof(input) - 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.value<std::string>(), "bravo");
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.literal().size(), sizeof(input) - 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.value<std::string>(), "bravo");
+}
+
+void test_escaped_quote()
+{
+    char input[] = "[\"a\\\"b\\n\",1]";
+    json::reader reader(json::in_situ, input, sizeof(input) - 1);
+    std::string scratch;
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.literal().size(), 8);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.string_view(scratch), "a\"b\n");
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.literal().size(), 8);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.string_view(scratch), "a\"b\n");
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.value<std::string>(), "a\"b\n");
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.value<int>(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), json::token::symbol::end_array);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), false);
+}
+
+void test_object()
+{
+    char input[] = "{\"alpha\":\"hydro\\u0067en\",\"bra\\u0076o\":\"helium\"}";
+    json::reader reader(json::in_situ, input, sizeof(input) - 1);
+    std::string scratch;
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.string_view(scratch), "alpha");
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    auto hydrogen = reader.string_view(scratch);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    auto bravo = reader.string_view(scratch);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.string_view(scratch), "helium");
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), json::token::symbol::end_object);
+    // Earlier views remain valid
+    TRIAL_PROTOCOL_TEST_EQUAL(hydrogen, "hydrogen");
+    TRIAL_PROTOCOL_TEST_EQUAL(bravo, "bravo");
+    TRIAL_PROTOCOL_TEST(scratch.empty());
+}
+
+void run()
+{
+    test_unescaped();
+    test_escaped();
+    test_escaped_reverse_solidus();
+    test_value();
+    test_escaped_quote();
+    test_object();
+}
+
+} // namespace in_situ_suite
+
+//-----------------------------------------------------------------------------
+// Nesting
+//-----------------------------------------------------------------------------
+
+namespace nesting_suite
+{
+
+void test_deep_array()
+{
+    // Exceeds inline capacity
+    const std::string input = std::string(100, '[') + std::string(100, ']');
+    json::reader reader(input);
+    for (std::size_t i = 1; i <= 100; ++i)
+    {
+        TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::begin_array);
+        TRIAL_PROTOCOL_TEST_EQUAL(reader.level(), i - 1);
+        reader.next();
+    }
+    for (std::size_t i = 100; i > 0; --i)
+    {
+        TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::end_array);
+        TRIAL_PROTOCOL_TEST_EQUAL(reader.level(), i);
+        reader.next();
+    }
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::end);
+}
+
+void test_small_capacity()
+{
+    const char input[] = "[{\"alpha\":[[true]]}]";
+    json::basic_reader<char, 2> reader(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::begin_array);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::begin_object);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::string);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::begin_array);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::begin_array);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.level(), 3);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::boolean);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::end_array);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::end_array);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::end_object);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::end_array);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), false);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::end);
+}
+
+void test_max_level()
+{
+    const char input[] = "[[]]";
+    json::reader reader(input, 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::begin_array);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::begin_array);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::end_array);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::end_array);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), false);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::end);
+}
+
+void fail_max_level_array()
+{
+    const char input[] = "[[[]]]";
+    json::reader reader(input, 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::begin_array);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::begin_array);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::begin_array);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), false);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::error);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.error(), json::nesting_limit);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.level(), 2);
+}
+
+void fail_max_level_object()
+{
+    const char input[] = "{\"alpha\":{}}";
+    json::reader reader(input, 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::begin_object);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::string);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::begin_object);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), false);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.error(), json::nesting_limit);
+}
+
+void fail_max_level_zero()
+{
+    const char input[] = "[]";
+    json::reader reader(input, 0);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::begin_array);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), false);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::error);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.error(), json::nesting_limit);
+}
+
+void run()
+{
+    test_deep_array();
+    test_small_capacity();
+    test_max_level();
+    fail_max_level_array();
+    fail_max_level_object();
+    fail_max_level_zero();
+}
+
+} // namespace nesting_suite
+
 //-----------------------------------------------------------------------------
 // main
 //-----------------------------------------------------------------------------
@@ -903,6 +1211,9 @@ int main()
     ubasic_suite::run();
     array_suite::run();
     object_suite::run();
+    string_view_suite::run();
+    in_situ_suite::run();
+    nesting_suite::run();
 
     return boost::report_errors();
 }
@@ -8,6 +8,7 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <string>
 #include <trial/protocol/json/partial/skip.hpp>
 #include <trial/protocol/core/detail/lightweight_test.hpp>
 
@@ -206,6 +207,152 @@ void fail_on_close_object()
     TRIAL_PROTOCOL_TEST_EQUAL(ec, json::errc::insufficient_tokens);
 }
 
+void test_index_array()
+{
+    const char input[] = R"([
+        [],
+        42,
+        [ "test]", false, [32, "fo\"o]"] ],
+        {"bar": ["}"]},
+        46
+    ])";
+    json::partial::skip_index index(input);
+    json::reader reader(input);
+    json::reader::view_type skipped;
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::begin_array);
+    TRIAL_PROTOCOL_TEST(reader.next());
+
+    skipped = json::partial::skip(reader, index);
+    TRIAL_PROTOCOL_TEST_EQUAL(skipped, "[]");
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.level(), 1);
+
+    skipped = json::partial::skip(reader, index);
+    TRIAL_PROTOCOL_TEST_EQUAL(skipped, "42");
+
+    skipped = json::partial::skip(reader, index);
+    TRIAL_PROTOCOL_TEST_EQUAL(skipped, R"([ "test]", false, [32, "fo\"o]"] ])");
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.level(), 1);
+
+    skipped = json::partial::skip(reader, index);
+    TRIAL_PROTOCOL_TEST_EQUAL(skipped, R"({"bar": ["}"]})");
+
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::integer);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.value<int>(), 46);
+    TRIAL_PROTOCOL_TEST(reader.next());
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::end_array);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.level(), 1);
+    TRIAL_PROTOCOL_TEST(!reader.next());
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::end);
+}
+
+void test_index_object()
+{
+    const char input[] = R"({"alpha":{"bravo":[1,2,3]},"charlie":true})";
+    json::partial::skip_index index(input);
+    json::reader reader(input);
+    TRIAL_PROTOCOL_TEST(reader.next());
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.value<std::string>(), "alpha");
+    TRIAL_PROTOCOL_TEST(reader.next());
+    auto skipped = json::partial::skip(reader, index);
+    TRIAL_PROTOCOL_TEST_EQUAL(skipped, R"({"bravo":[1,2,3]})");
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::string);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.value<std::string>(), "charlie");
+    TRIAL_PROTOCOL_TEST(reader.next());
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::true_value);
+}
+
+void test_index_outer()
+{
+    const char input[] = R"({"skip": ["me"]})";
+    json::partial::skip_index index(input);
+    json::reader reader(input);
+    auto skipped = json::partial::skip(reader, index);
+    TRIAL_PROTOCOL_TEST_EQUAL(skipped, input);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::end);
+}
+
+void test_index_other_buffer()
+{
+    // Falls back to tokenizing skip
+    json::partial::skip_index index("[[1]]");
+    json::reader reader("[[1]]");
+    auto skipped = json::partial::skip(reader, index);
+    TRIAL_PROTOCOL_TEST_EQUAL(skipped, "[[1]]");
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::end);
+}
+
+void test_unchecked_array()
+{
+    const char input[] = R"([[ "test]", false, [32, "fo\\"], {"}": "{"} ], 42])";
+    json::reader reader(input);
+    TRIAL_PROTOCOL_TEST(reader.next());
+    auto skipped = json::partial::skip_unchecked(reader);
+    TRIAL_PROTOCOL_TEST_EQUAL(skipped, R"([ "test]", false, [32, "fo\\"], {"}": "{"} ])");
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::integer);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.level(), 1);
+    skipped = json::partial::skip_unchecked(reader);
+    TRIAL_PROTOCOL_TEST_EQUAL(skipped, "42");
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::end_array);
+}
+
+void test_unchecked_long()
+{
+    namespace simd = trial::protocol::core::detail::simd;
+
+    std::string input = "[[";
+    for (int i = 0; i < 100; ++i)
+        input += R"("alpha \"bravo\" charlie", 1234567890, {"delta": [true]},)";
+    input += "null],0]";
+
+    // Run for each instruction set supported by the processor
+    const simd::instruction_set best = simd::detect();
+    const simd::instruction_set candidates[] = { simd::instruction_set::scalar,
+                                                 simd::instruction_set::sse2,
+                                                 simd::instruction_set::avx2 };
+    for (auto isa : candidates)
+    {
+        if (isa > best)
+            break;
+        simd::selected() = isa;
+        json::reader reader(input);
+        TRIAL_PROTOCOL_TEST(reader.next());
+        auto skipped = json::partial::skip_unchecked(reader);
+        TRIAL_PROTOCOL_TEST_EQUAL(skipped.size(), input.size() - 4);
+        TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::integer);
+        json::partial::skip_index index(input);
+        TRIAL_PROTOCOL_TEST(index.find(input.data() + 1) == input.data() + input.size() - 4);
+    }
+    simd::selected() = best;
+}
+
+void fail_unchecked_unterminated()
+{
+    json::reader reader(R"({"skip": ["me"})");
+    std::error_code ec;
+    auto skipped = json::partial::skip_unchecked(reader, ec);
+    TRIAL_PROTOCOL_TEST_EQUAL(skipped, "");
+    TRIAL_PROTOCOL_TEST_EQUAL(ec, json::errc::insufficient_tokens);
+}
+
+void fail_unchecked_mismatched()
+{
+    json::reader reader(R"({"skip": "me"])");
+    std::error_code ec;
+    json::partial::skip_unchecked(reader, ec);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::error);
+    TRIAL_PROTOCOL_TEST_EQUAL(ec, json::errc::expected_end_array);
+}
+
+void fail_unchecked_comma_after_object()
+{
+    json::reader reader(R"({"skip": "me"},)");
+    std::error_code ec;
+    auto skipped = json::partial::skip_unchecked(reader, ec);
+    TRIAL_PROTOCOL_TEST_EQUAL(skipped, R"({"skip": "me"})");
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.symbol(), token::symbol::error);
+    TRIAL_PROTOCOL_TEST_EQUAL(ec, json::errc::unexpected_token);
+}
+
 //-----------------------------------------------------------------------------
 // main
 //-----------------------------------------------------------------------------
@@ -223,6 +370,15 @@ int main()
     fail_invalid_token_in_middle_of_object2();
     fail_on_close_array();
     fail_on_close_object();
+    test_index_array();
+    test_index_object();
+    test_index_outer();
+    test_index_other_buffer();
+    test_unchecked_array();
+    test_unchecked_long();
+    fail_unchecked_unterminated();
+    fail_unchecked_mismatched();
+    fail_unchecked_comma_after_object();
 
     return boost::report_errors();
 }
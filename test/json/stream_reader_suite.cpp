@@ -0,0 +1,348 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <trial/protocol/json/reader.hpp>
+#include <trial/protocol/json/stream_reader.hpp>
+#include <trial/protocol/core/detail/lightweight_test.hpp>
+
+using namespace trial::protocol;
+namespace token = json::token;
+
+//-----------------------------------------------------------------------------
+// Basic
+//-----------------------------------------------------------------------------
+
+namespace basic_suite
+{
+
+void test_empty()
+{
+    json::stream_reader reader;
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), false);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.needs_input(), true);
+    reader.finish();
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), false);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.needs_input(), false);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::end);
+}
+
+void test_whole()
+{
+    json::stream_reader reader;
+    reader.append("[true,42]");
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::begin_array);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.level(), 0);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::true_value);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.level(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::integer);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.value<int>(), 42);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::end_array);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), false);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.needs_input(), true);
+    reader.finish();
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), false);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.needs_input(), false);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::end);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.level(), 0);
+}
+
+void test_split_keyword()
+{
+    json::stream_reader reader;
+    reader.append("[tr");
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::begin_array);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), false);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.needs_input(), true);
+    // Current token is retained
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::begin_array);
+    reader.append("ue]");
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::true_value);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.literal(), "true");
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::end_array);
+}
+
+void test_split_number()
+{
+    json::stream_reader reader;
+    reader.append("12");
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), false);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.needs_input(), true);
+    reader.append("34");
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), false);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.needs_input(), true);
+    reader.finish();
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::integer);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.value<int>(), 1234);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), false);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::end);
+}
+
+void test_split_string()
+{
+    json::stream_reader reader;
+    reader.append("{\"al\\");
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), false);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.needs_input(), true);
+    reader.append("u0070ha\":");
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::string);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.value<std::string>(), "alpha");
+    reader.append("\"bravo\"}");
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.value<std::string>(), "bravo");
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::end_object);
+}
+
+void test_value_separator()
+{
+    json::stream_reader reader;
+    reader.append("[1");
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    reader.append(",");
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.value<int>(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), false);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.needs_input(), true);
+    reader.append("2]");
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.value<int>(), 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.level(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::end_array);
+}
+
+void fail_truncated()
+{
+    json::stream_reader reader;
+    reader.append("[tru");
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), false);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.needs_input(), true);
+    reader.finish();
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), false);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.needs_input(), false);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.error(), json::unexpected_token);
+}
+
+void fail_trailing_separator()
+{
+    json::stream_reader reader;
+    reader.append("[1,]                ");
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), false);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.needs_input(), false);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.error(), json::unexpected_token);
+}
+
+void test_not_reader()
+{
+    // Functions that take a reader would accept truncated tokens
+    static_assert(!std::is_convertible<json::stream_reader&, json::reader&>::value,
+                  "stream_reader must not be usable as reader");
+
+    json::stream_reader reader;
+    reader.append("[12");
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), false);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.needs_input(), true);
+    reader.append("34]");
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.value<int>(), 1234);
+}
+
+void run()
+{
+    test_empty();
+    test_whole();
+    test_not_reader();
+    test_split_keyword();
+    test_split_number();
+    test_split_string();
+    test_value_separator();
+    fail_truncated();
+    fail_trailing_separator();
+}
+
+} // namespace basic_suite
+
+//-----------------------------------------------------------------------------
+// Chunks
+//-----------------------------------------------------------------------------
+
+namespace chunk_suite
+{
+
+using tokens = std::vector<std::string>;
+
+std::string to_string(const json::reader::view_type& view)
+{
+    return std::string(view.begin(), view.end());
+}
+
+tokens parse_whole(const std::string& input)
+{
+    tokens result;
+    json::reader reader(input);
+    do
+    {
+        if (reader.category() == token::category::status)
+            break;
+        result.push_back(to_string(reader.literal()));
+    } while (reader.next());
+    if (reader.symbol() == token::symbol::error)
+        result.push_back("error");
+    return result;
+}
+
+tokens parse_chunked(const std::string& input, std::size_t chunk_size)
+{
+    tokens result;
+    json::stream_reader reader;
+    std::size_t position = 0;
+    for (;;)
+    {
+        if (reader.next())
+        {
+            result.push_back(to_string(reader.literal()));
+        }
+        else if (reader.needs_input())
+        {
+            if (position < input.size())
+            {
+                const std::size_t size = std::min(chunk_size, input.size() - position);
+                reader.append(json::stream_reader::view_type(input.data() + position, size));
+                position += size;
+            }
+            else
+            {
+                reader.finish();
+            }
+        }
+        else
+        {
+            break;
+        }
+    }
+    if (reader.symbol() == token::symbol::error)
+        result.push_back("error");
+    return result;
+}
+
+void check(const std::string& input)
+{
+    const tokens expected = parse_whole(input);
+    for (std::size_t chunk_size = 1; chunk_size <= input.size(); ++chunk_size)
+    {
+        const tokens result = parse_chunked(input, chunk_size);
+        TRIAL_PROTOCOL_TEST_ALL_EQUAL(result.begin(), result.end(),
+                                      expected.begin(), expected.end());
+    }
+}
+
+void test_documents()
+{
+    check("null");
+    check("  1234.5e-6  ");
+    check("\"alpha\"");
+    check("[]");
+    check("[null,true,false,0,-1,2.5,\"alpha\"]");
+    check("{\"alpha\":[1,{\"bravo\":\"charlie\\n\\u00e6\"}],\"delta\":{}}");
+    check("[ [ [ 1 , 2 ] , [ ] ] , { } ]\n");
+    check("\"\xC3\xA6\xE2\x82\xAC\"");
+}
+
+void test_errors()
+{
+    check("[1,]");
+    check("[1 2]");
+    check("{\"alpha\" 1}");
+    check("[tru]");
+    check("[1}");
+    check("\"alpha");
+    check("1 2");
+    check("[1,]             [2]");
+}
+
+void test_bounded()
+{
+    std::string input = "[";
+    for (int i = 0; i < 1000; ++i)
+    {
+        if (i > 0)
+            input += ",";
+        input += "\"alpha\",12345";
+    }
+    input += "]";
+
+    const std::size_t chunk_size = 64;
+    json::stream_reader reader;
+    std::size_t position = 0;
+    int count = 0;
+    for (;;)
+    {
+        if (reader.next())
+        {
+            ++count;
+            TRIAL_PROTOCOL_TEST(reader.literal().size() + reader.tail().size() <= 2 * chunk_size);
+        }
+        else if (reader.needs_input())
+        {
+            if (position == input.size())
+            {
+                reader.finish();
+                continue;
+            }
+            const std::size_t size = std::min(chunk_size, input.size() - position);
+            reader.append(json::stream_reader::view_type(input.data() + position, size));
+            position += size;
+        }
+        else
+        {
+            break;
+        }
+    }
+    TRIAL_PROTOCOL_TEST_EQUAL(count, 2002);
+    TRIAL_PROTOCOL_TEST_EQUAL(reader.code(), token::code::end);
+}
+
+void run()
+{
+    test_documents();
+    test_errors();
+    test_bounded();
+}
+
+} // namespace chunk_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    basic_suite::run();
+    chunk_suite::run();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,287 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <trial/protocol/json/reader.hpp>
+#include <trial/protocol/json/tape.hpp>
+#include <trial/protocol/core/detail/lightweight_test.hpp>
+
+using namespace trial::protocol;
+namespace token = json::token;
+
+//-----------------------------------------------------------------------------
+// Basic
+//-----------------------------------------------------------------------------
+
+namespace basic_suite
+{
+
+void test_empty()
+{
+    const char input[] = "";
+    json::tape tape(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(tape.size(), 1);
+    auto cursor = tape.begin();
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.code(), token::code::end);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.next(), false);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.code(), token::code::end);
+}
+
+void test_value()
+{
+    const char input[] = "  42 ";
+    json::tape tape(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(tape.size(), 2);
+    auto cursor = tape.begin();
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.code(), token::code::integer);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.literal(), "42");
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.value<int>(), 42);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.value<double>(), 42.0);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.next(), false);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.code(), token::code::end);
+}
+
+void test_array()
+{
+    const char input[] = "[null,true,3.5,\"alpha\"]";
+    json::tape tape(input);
+    TRIAL_PROTOCOL_TEST_EQUAL(tape.size(), 7);
+    auto cursor = tape.begin();
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.symbol(), token::symbol::begin_array);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.level(), 0);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.symbol(), token::symbol::null);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.level(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.symbol(), token::symbol::boolean);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.value<bool>(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.symbol(), token::symbol::real);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.value<double>(), 3.5);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.symbol(), token::symbol::string);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.value<std::string>(), "alpha");
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.symbol(), token::symbol::end_array);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.level(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.next(), false);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.symbol(), token::symbol::end);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.level(), 0);
+}
+
+void test_string_view()
+{
+    const char input[] = "[\"alpha\",\"bra\\u0076o\"]";
+    json::tape tape(input);
+    auto cursor = tape.begin();
+    std::string scratch;
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.next(), true);
+    json::tape::view_type result = cursor.string_view(scratch);
+    TRIAL_PROTOCOL_TEST_EQUAL(result, "alpha");
+    TRIAL_PROTOCOL_TEST(result.data() == input + 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.string_view(scratch), "bravo");
+}
+
+void test_integer_values()
+{
+    const char input[] = "[-7,0,18446744073709551615,2.5,\"a\\\"b\"]";
+    json::tape tape(input);
+    auto cursor = tape.begin();
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.value<int>(), -7);
+    TRIAL_PROTOCOL_TEST_THROWS(cursor.value<unsigned int>(), json::error);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.value<int>(), 0);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.value<unsigned long long>(), 18446744073709551615ULL);
+    TRIAL_PROTOCOL_TEST_THROWS(cursor.value<long long>(), json::error);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.value<int>(), 3);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.value<std::string>(), "a\"b");
+    TRIAL_PROTOCOL_TEST_THROWS(cursor.value<int>(), json::error);
+}
+
+void run()
+{
+    test_empty();
+    test_value();
+    test_array();
+    test_string_view();
+    test_integer_values();
+}
+
+} // namespace basic_suite
+
+//-----------------------------------------------------------------------------
+// Skip
+//-----------------------------------------------------------------------------
+
+namespace skip_suite
+{
+
+void skip_value()
+{
+    const char input[] = "[1,2]";
+    json::tape tape(input);
+    auto cursor = tape.begin();
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.skip(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.literal(), "2");
+}
+
+void skip_array()
+{
+    const char input[] = "[[1,[2,3]],{\"alpha\":[4]},5]";
+    json::tape tape(input);
+    auto cursor = tape.begin();
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.symbol(), token::symbol::begin_array);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.level(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.skip(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.symbol(), token::symbol::begin_object);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.level(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.skip(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.symbol(), token::symbol::integer);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.value<int>(), 5);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.level(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.next(), true);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.symbol(), token::symbol::end_array);
+}
+
+void skip_outer()
+{
+    const char input[] = "{\"alpha\":[4]}";
+    json::tape tape(input);
+    auto cursor = tape.begin();
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.skip(), false);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.symbol(), token::symbol::end);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.level(), 0);
+}
+
+void run()
+{
+    skip_value();
+    skip_array();
+    skip_outer();
+}
+
+} // namespace skip_suite
+
+//-----------------------------------------------------------------------------
+// Reader compatibility
+//-----------------------------------------------------------------------------
+
+namespace reader_suite
+{
+
+void compare(const std::string& input)
+{
+    json::reader reader(input);
+    json::tape tape(input);
+    auto cursor = tape.begin();
+    do
+    {
+        TRIAL_PROTOCOL_TEST_EQUAL(cursor.code(), reader.code());
+        TRIAL_PROTOCOL_TEST_EQUAL(cursor.level(), reader.level());
+        TRIAL_PROTOCOL_TEST_EQUAL(cursor.literal(), reader.literal());
+        TRIAL_PROTOCOL_TEST_EQUAL(cursor.next(), reader.next());
+    } while (reader.symbol() != token::symbol::end);
+    TRIAL_PROTOCOL_TEST_EQUAL(cursor.code(), token::code::end);
+}
+
+void test_nested()
+{
+    compare("[]");
+    compare("{}");
+    compare("[[],{}]");
+    compare("{\"alpha\":{\"bravo\":[1,2.0,\"three\",null,false]},\"charlie\":[]}");
+    compare(" [ 1 , [ 2 , [ 3 ] ] ] ");
+}
+
+void test_delimiters_in_strings()
+{
+    // Delimiters inside strings are not counted as tokens
+    compare("[\",:[]{}\",\"\\\",\",{\"[\":\"]\"}]");
+    compare("{\"\\\\\":[\"\\\\\",1]}");
+    compare("\"[[[[[[[[\"");
+}
+
+void run()
+{
+    test_nested();
+    test_delimiters_in_strings();
+}
+
+} // namespace reader_suite
+
+//-----------------------------------------------------------------------------
+// Errors
+//-----------------------------------------------------------------------------
+
+namespace error_suite
+{
+
+void fail_unbalanced_end_array()
+{
+    const char input[] = "]";
+    TRIAL_PROTOCOL_TEST_THROW_EQUAL(json::tape tape(input),
+                                    json::error, "unbalanced end array bracket");
+}
+
+void fail_missing_end_array()
+{
+    const char input[] = "[1,2";
+    TRIAL_PROTOCOL_TEST_THROWS(json::tape tape(input), json::error);
+}
+
+void fail_mismatched()
+{
+    const char input[] = "[1,2}";
+    TRIAL_PROTOCOL_TEST_THROWS(json::tape tape(input), json::error);
+}
+
+void fail_trailing()
+{
+    const char input[] = "[1] 2";
+    TRIAL_PROTOCOL_TEST_THROWS(json::tape tape(input), json::error);
+}
+
+void fail_invalid_value()
+{
+    const char input[] = "[1,nul]";
+    TRIAL_PROTOCOL_TEST_THROWS(json::tape tape(input), json::error);
+}
+
+void run()
+{
+    fail_unbalanced_end_array();
+    fail_missing_end_array();
+    fail_mismatched();
+    fail_trailing();
+    fail_invalid_value();
+}
+
+} // namespace error_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    basic_suite::run();
+    skip_suite::run();
+    reader_suite::run();
+    error_suite::run();
+
+    return boost::report_errors();
+}
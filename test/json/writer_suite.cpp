@@ -8,8 +8,15 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <array>
+#include <limits>
 #include <sstream>
+#include <string>
+#include <vector>
+#include <trial/protocol/buffer/array.hpp>
 #include <trial/protocol/buffer/ostream.hpp>
+#include <trial/protocol/buffer/string.hpp>
+#include <trial/protocol/buffer/vector.hpp>
 #include <trial/protocol/json/writer.hpp>
 #include <trial/protocol/core/detail/lightweight_test.hpp>
 
@@ -159,10 +166,32 @@ void test_zero()
     TRIAL_PROTOCOL_TEST_EQUAL(result.str(), "0.00000000000000");
 }
 
+void test_shortest_zero()
+{
+    std::ostringstream result;
+    json::writer writer(result, json::real_format::shortest);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value(0.0), 3);
+    TRIAL_PROTOCOL_TEST_EQUAL(result.str(), "0.0");
+}
+
+void test_shortest_array()
+{
+    std::ostringstream result;
+    json::writer writer(result, json::real_format::shortest);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value<token::begin_array>(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value(0.1), 3);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value(2.5f), 3);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value(1e300), 6);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value<token::end_array>(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(result.str(), "[0.1,2.5,1e+300]");
+}
+
 void run()
 {
     test_literal_zero();
     test_zero();
+    test_shortest_zero();
+    test_shortest_array();
 }
 
 } // namespace number_suite
@@ -377,6 +406,81 @@ void run()
 
 } // namespace object_suite
 
+//-----------------------------------------------------------------------------
+// Statically dispatched buffers
+//-----------------------------------------------------------------------------
+
+namespace static_suite
+{
+
+template <typename OutputType>
+using static_writer = json::basic_writer<char, 2 * sizeof(void *), OutputType>;
+
+void test_string()
+{
+    std::string result;
+    static_writer<std::string> writer(result);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value<token::begin_array>(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value(true), 4);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value(-42), 3);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value("alpha"), 7);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value<token::end_array>(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(result, "[true,-42,\"alpha\"]");
+}
+
+void test_vector()
+{
+    std::vector<char> result;
+    static_writer<std::vector<char>> writer(result);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value<token::begin_object>(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value("key"), 5);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value<token::null>(), 4);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value<token::end_object>(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(std::string(result.begin(), result.end()), "{\"key\":null}");
+}
+
+void test_array()
+{
+    std::array<char, 8> result;
+    static_writer<std::array<char, 8>> writer(result);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value(12345), 5);
+    TRIAL_PROTOCOL_TEST_EQUAL(std::string(result.data(), 5), "12345");
+    // Does not fit
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.literal(json::writer::view_type("6789")), 0);
+}
+
+void test_ostream()
+{
+    std::ostringstream result;
+    static_writer<std::ostringstream> writer(result);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value(-7), 2);
+    TRIAL_PROTOCOL_TEST_EQUAL(result.str(), "-7");
+}
+
+void test_integer_limits()
+{
+    std::string result;
+    static_writer<std::string> writer(result);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value<token::begin_array>(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value(std::numeric_limits<std::int64_t>::min()), 20);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value(std::numeric_limits<std::uint64_t>::max()), 20);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value(std::numeric_limits<signed char>::min()), 4);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value(0), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(writer.value<token::end_array>(), 1);
+    TRIAL_PROTOCOL_TEST_EQUAL(result, "[-9223372036854775808,18446744073709551615,-128,0]");
+}
+
+void run()
+{
+    test_string();
+    test_vector();
+    test_array();
+    test_ostream();
+    test_integer_limits();
+}
+
+} // namespace static_suite
+
 //-----------------------------------------------------------------------------
 // main
 //-----------------------------------------------------------------------------
@@ -390,6 +494,7 @@ int main()
     string_suite::run();
     array_suite::run();
     object_suite::run();
+    static_suite::run();
 
     return boost::report_errors();
 }